@@ -0,0 +1,152 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+using Clock = std::chrono::steady_clock;
+
+// Keep the compiler from optimizing away a computed value
+template <typename T>
+void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// Median wall time of running fn reps times
+template <typename F>
+std::chrono::nanoseconds medianTime(const int reps, F&& fn) {
+    std::vector<std::chrono::nanoseconds> times;
+    times.reserve(reps);
+    for (int i = 0; i < reps; ++i) {
+        const auto start = Clock::now();
+        fn();
+        times.push_back(Clock::now() - start);
+    }
+    auto it_mid = times.begin() + times.size() / 2;
+    std::nth_element(times.begin(), it_mid, times.end());
+    return *it_mid;
+}
+
+// For prepare functions of kernels with several implementations: checks that an implementation
+// returns the same as the reference one on the prepared input, before any of it is timed
+/// @throws std::logic_error if the results differ
+template <typename T>
+void checkAgrees(const T& result, const T& reference, const std::string& what) {
+    if (!(result == reference)) throw std::logic_error(what + " disagrees with the reference");
+}
+
+// One input of a kernel, prepared outside of the timing
+struct Case {
+    std::function<void()> run;  // the timed work
+    size_t elements;            // number of elements processed by one run
+    size_t bytes{};             // if set, the bytes of input one run reads, to report throughput
+    // if set, called before every run without timing, e.g. to refill an input which run consumes
+    std::function<void()> setup{};
+};
+
+// A kernel benchmarked at several input sizes
+struct Benchmark {
+    std::string name;
+    std::string element;  // what one element is, e.g. "value" or "cell"
+    std::vector<size_t> sizes;
+    std::function<Case(size_t size)> prepare;
+};
+
+struct Result {
+    std::string name;
+    size_t size;
+    size_t elements;
+    double ns_per_run;
+    double ns_per_element;
+    double gb_per_s;  // 0 if the case has no bytes
+};
+
+struct Options {
+    std::string filter;  // only run benchmarks whose name contains this
+    int reps = 7;        // timed samples per size, of which the median is reported
+    double scale = 1.0;  // factor for all sizes
+    std::chrono::nanoseconds min_sample = std::chrono::milliseconds(2);
+};
+
+// Median time of one run of a prepared case. Without setup, short runs are repeated within a
+// sample until it takes at least min_sample, so the clock resolution doesn't matter.
+inline std::chrono::nanoseconds timeCase(const Case& c, const Options& options) {
+    if (c.setup) c.setup();
+    const auto warmup_start = Clock::now();
+    c.run();
+    const std::chrono::nanoseconds warmup = Clock::now() - warmup_start;
+
+    int iterations = 1;
+    if (!c.setup && warmup < options.min_sample) {
+        iterations = static_cast<int>(std::min<int64_t>(
+            1'000'000, options.min_sample.count() / std::max<int64_t>(1, warmup.count()) + 1));
+    }
+
+    std::vector<std::chrono::nanoseconds> times;
+    for (int i = 0; i < options.reps; ++i) {
+        if (c.setup) c.setup();
+        const auto start = Clock::now();
+        for (int j = 0; j < iterations; ++j) c.run();
+        times.push_back((Clock::now() - start) / iterations);
+    }
+    auto it_mid = times.begin() + times.size() / 2;
+    std::nth_element(times.begin(), it_mid, times.end());
+    return *it_mid;
+}
+
+// Run all selected benchmarks at all their sizes and print one row per size
+inline std::vector<Result> runBenchmarks(const std::vector<Benchmark>& benchmarks,
+                                         const Options& options, std::ostream& os) {
+    os << std::left << std::setw(28) << "benchmark" << std::right << std::setw(10) << "size"
+       << std::setw(12) << "elements" << std::setw(12) << "ms/run" << std::setw(14)
+       << "ns/element" << std::setw(10) << "GB/s" << "  element\n";
+
+    std::vector<Result> results;
+    for (const Benchmark& benchmark : benchmarks) {
+        if (benchmark.name.find(options.filter) == std::string::npos) continue;
+        for (const size_t base_size : benchmark.sizes) {
+            const auto scaled = std::llround(static_cast<double>(base_size) * options.scale);
+            const size_t size = std::max<size_t>(1, static_cast<size_t>(scaled));
+            const Case c = benchmark.prepare(size);
+            const auto time = timeCase(c, options);
+
+            const Result& result = results.emplace_back(
+                Result{.name = benchmark.name,
+                       .size = size,
+                       .elements = c.elements,
+                       .ns_per_run = static_cast<double>(time.count()),
+                       .ns_per_element = static_cast<double>(time.count()) /
+                                         static_cast<double>(std::max<size_t>(1, c.elements)),
+                       .gb_per_s = static_cast<double>(c.bytes) /
+                                   static_cast<double>(std::max<int64_t>(1, time.count()))});
+            os << std::left << std::setw(28) << result.name << std::right << std::setw(10)
+               << result.size << std::setw(12) << result.elements << std::fixed
+               << std::setprecision(3) << std::setw(12) << result.ns_per_run / 1e6
+               << std::setprecision(2) << std::setw(14) << result.ns_per_element << std::setw(10);
+            if (c.bytes > 0) {
+                os << result.gb_per_s;
+            } else {
+                os << "-";
+            }
+            os << "  " << benchmark.element << "\n";
+        }
+    }
+    return results;
+}
+
+}  // namespace bench
@@ -0,0 +1,891 @@
+// Benchmark the core functions of several days directly on generated inputs of different sizes.
+// Inputs are generated with a fixed seed, so results are comparable between builds.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "aoc/split.h"
+#include "aoc/thread_pool.h"
+#include "bench.h"
+#include "day01.h"
+#include "day02.h"
+#include "day03.h"
+#include "day04.h"
+#include "day05.h"
+#include "day06.h"
+#include "day15.h"
+#include "day16.h"
+#include "day18.h"
+#include "day19.h"
+
+namespace {
+
+using Rng = std::mt19937_64;
+
+// uniform in [lo, hi]; unlike the std distributions the same with every standard library
+int uniform(Rng& rng, const int lo, const int hi) {
+    return lo + static_cast<int>(rng() % static_cast<uint64_t>(hi - lo + 1));
+}
+
+// The prepared inputs are shared with the returned run functions, which may be copied
+template <typename T>
+std::shared_ptr<T> shared(T value) {
+    return std::make_shared<T>(std::move(value));
+}
+
+std::vector<int> makeDepths(const size_t size) {
+    Rng rng(1);
+    std::vector<int> values;
+    values.reserve(size);
+    int depth = 200;
+    for (size_t i = 0; i < size; ++i) {
+        depth = std::max(0, depth + uniform(rng, -20, 30));
+        values.push_back(depth);
+    }
+    return values;
+}
+
+bench::Case countIncreases(const size_t size, const int window_size, const day01::Isa isa) {
+    auto values = shared(makeDepths(size));
+    bench::checkAgrees(day01::countIncreases(*values, window_size, isa),
+                       day01::countIncreases(*values, window_size, day01::Isa::SCALAR),
+                       std::string("countIncreases ") + day01::isaName(isa));
+    return {.run = [values, window_size, isa]() {
+                bench::doNotOptimize(day01::countIncreases(*values, window_size, isa));
+            },
+            .elements = size,
+            .bytes = size * sizeof(int)};
+}
+
+bench::Case countIncreasesParallel(const size_t size, const size_t num_threads) {
+    // the calling thread is one of the threads
+    auto pool = std::make_shared<aoc::ThreadPool>(num_threads - 1);
+    auto values = shared(makeDepths(size));
+    bench::checkAgrees(day01::countIncreases(*values, 3, *pool),
+                       day01::countIncreases(*values, 3, day01::Isa::SCALAR),
+                       "countIncreases in chunks");
+    return {.run = [values, pool]() {
+                bench::doNotOptimize(day01::countIncreases(*values, 3, *pool));
+            },
+            .elements = size,
+            .bytes = size * sizeof(int)};
+}
+
+// countIncreases with every instruction set the CPU supports
+std::vector<bench::Benchmark> countIncreasesBenchmarks() {
+    std::vector<bench::Benchmark> benchmarks;
+    for (const int window_size : {1, 3}) {
+        for (const day01::Isa isa : {day01::Isa::SCALAR, day01::Isa::SSE2, day01::Isa::AVX2}) {
+            if (!day01::isSupported(isa)) continue;
+            benchmarks.push_back(
+                {"day01 countIncreases/" + std::to_string(window_size) + " " + day01::isaName(isa),
+                 "value",
+                 {1'000, 1'000'000, 100'000'000},
+                 [window_size, isa](const size_t size) {
+                     return countIncreases(size, window_size, isa);
+                 }});
+        }
+    }
+    // scaling with the number of threads
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t num_threads = 1;; num_threads = std::min(num_threads * 2, max_threads)) {
+        benchmarks.push_back({"day01 countIncreases/3 " + std::to_string(num_threads) + " thr",
+                              "value",
+                              {1'000'000, 100'000'000},
+                              [num_threads](const size_t size) {
+                                  return countIncreasesParallel(size, num_threads);
+                              }});
+        if (num_threads == max_threads) break;
+    }
+    return benchmarks;
+}
+
+std::vector<day02::Command> makeCommands(const size_t size) {
+    constexpr day02::Opcode OPCODES[] = {day02::Opcode::FORWARD, day02::Opcode::DOWN,
+                                         day02::Opcode::UP};
+    Rng rng(2);
+    std::vector<day02::Command> commands;
+    commands.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        commands.emplace_back(OPCODES[rng() % 3], uniform(rng, 1, 9));
+    }
+    return commands;
+}
+
+template <typename Submarine>
+bench::Case followCommands(const size_t size) {
+    return {.run =
+                [commands = shared(makeCommands(size))]() {
+                    Submarine submarine;
+                    submarine.followCommands(*commands);
+                    bench::doNotOptimize(submarine.getDepth());
+                },
+            .elements = size,
+            .bytes = size * sizeof(day02::Command)};
+}
+
+// The part 2 model followed command by command, as the reference of the parallel kernels
+day02::Position followSerially(const std::vector<day02::Command>& commands) {
+    day02::Submarine2 submarine;
+    submarine.followCommands(commands);
+    return submarine.getPosition();
+}
+
+bench::Case followCommandsParallel(const size_t size, const size_t num_threads) {
+    auto pool = std::make_shared<aoc::ThreadPool>(num_threads - 1);
+    auto commands = shared(makeCommands(size));
+    day02::Submarine2 parallel;
+    parallel.followCommands(*commands, *pool);
+    bench::checkAgrees(parallel.getPosition(), followSerially(*commands),
+                       "Submarine2::followCommands in chunks");
+    return {.run =
+                [commands, pool]() {
+                    day02::Submarine2 submarine;
+                    submarine.followCommands(*commands, *pool);
+                    bench::doNotOptimize(submarine.getDepth());
+                },
+            .elements = size,
+            .bytes = size * sizeof(day02::Command)};
+}
+
+bench::Case trajectory(const size_t size, const size_t num_threads) {
+    auto pool = std::make_shared<aoc::ThreadPool>(num_threads - 1);
+    auto commands = shared(makeCommands(size));
+    bench::checkAgrees(day02::trajectory(*commands, *pool).back(), followSerially(*commands),
+                       "trajectory");
+    return {.run =
+                [commands, pool]() {
+                    bench::doNotOptimize(day02::trajectory(*commands, *pool).back().depth);
+                },
+            .elements = size,
+            .bytes = size * (sizeof(day02::Command) + sizeof(day02::Position))};
+}
+
+// both models, and the parallel part 2 model on 1, 2, 4, ... threads
+std::vector<bench::Benchmark> followCommandsBenchmarks() {
+    std::vector<bench::Benchmark> benchmarks = {
+        {"day02 Submarine", "command", {1'000, 1'000'000, 10'000'000},
+         followCommands<day02::Submarine>},
+        {"day02 Submarine2", "command", {1'000, 1'000'000, 10'000'000},
+         followCommands<day02::Submarine2>},
+    };
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t num_threads = 1;; num_threads = std::min(num_threads * 2, max_threads)) {
+        const std::string threads = std::to_string(num_threads) + " thr";
+        benchmarks.push_back({"day02 Submarine2 " + threads,
+                              "command",
+                              {1'000'000, 10'000'000},
+                              [num_threads](const size_t size) {
+                                  return followCommandsParallel(size, num_threads);
+                              }});
+        benchmarks.push_back({"day02 trajectory " + threads,
+                              "command",
+                              {1'000'000, 10'000'000},
+                              [num_threads](const size_t size) {
+                                  return trajectory(size, num_threads);
+                              }});
+        if (num_threads == max_threads) break;
+    }
+    return benchmarks;
+}
+
+std::vector<std::string> makeReadings(const size_t size, const int num_bits) {
+    Rng rng(3);
+    std::vector<std::string> readings;
+    readings.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        std::string reading;
+        for (int bit = 0; bit < num_bits; ++bit) reading.push_back(rng() & 1 ? '1' : '0');
+        readings.push_back(std::move(reading));
+    }
+    return readings;
+}
+
+bench::Case packReadings(const size_t size) {
+    return {.run =
+                [readings = shared(makeReadings(size, 12))]() {
+                    day03::Readings packed(12);
+                    for (const std::string& reading : *readings) packed.push_back(reading);
+                    bench::doNotOptimize(packed.size());
+                },
+            .elements = size};
+}
+
+// Number of readings with a one at each digit from the right, counted digit by digit
+std::vector<int64_t> countOnesNaively(const std::vector<std::string>& readings,
+                                      const int num_bits) {
+    std::vector<int64_t> counts(num_bits, 0);
+    for (const std::string& reading : readings) {
+        for (int bit = 0; bit < num_bits; ++bit) counts[bit] += reading[num_bits - 1 - bit] == '1';
+    }
+    return counts;
+}
+
+// findRating by filtering the digit strings from the left, as the puzzle describes it
+std::string findRatingNaively(const std::vector<std::string>& readings,
+                              const bool keep_most_common) {
+    std::vector<const std::string*> left;
+    for (const std::string& reading : readings) left.push_back(&reading);
+    for (size_t digit = 0; left.size() > 1 && digit < readings.front().size(); ++digit) {
+        const auto ones = std::count_if(
+            left.begin(), left.end(), [digit](const std::string* r) { return (*r)[digit] == '1'; });
+        const auto zeros = static_cast<std::ptrdiff_t>(left.size()) - ones;
+        if (ones == 0 || zeros == 0) continue;
+        const char keep = (ones >= zeros) == keep_most_common ? '1' : '0';
+        std::erase_if(left, [digit, keep](const std::string* r) { return (*r)[digit] != keep; });
+    }
+    return left.size() == 1 ? *left.front() : "";
+}
+
+bench::Case countOnes(const size_t size, const int num_bits) {
+    const std::vector<std::string> digits = makeReadings(size, num_bits);
+    day03::Readings readings(num_bits);
+    for (const std::string& reading : digits) readings.push_back(reading);
+    bench::checkAgrees(day03::countOnes(readings), countOnesNaively(digits, num_bits),
+                       "countOnes/" + std::to_string(num_bits));
+    const size_t bytes = size * readings.wordsPerReading() * sizeof(uint64_t);
+    return {.run =
+                [readings = shared(std::move(readings))]() {
+                    bench::doNotOptimize(day03::countOnes(*readings).back());
+                },
+            .elements = size,
+            .bytes = bytes};
+}
+
+// What part 2 does: sort a copy of the readings, then find both ratings
+bench::Case ratings(const size_t size, const int num_bits) {
+    const std::vector<std::string> digits = makeReadings(size, num_bits);
+    day03::Readings readings(num_bits);
+    for (const std::string& reading : digits) readings.push_back(reading);
+    day03::Readings sorted_readings = readings;
+    sorted_readings.sort();
+    for (const bool keep_most_common : {true, false}) {
+        bench::checkAgrees(
+            day03::toBinString(day03::findRating(sorted_readings, keep_most_common), num_bits),
+            findRatingNaively(digits, keep_most_common), "findRating/" + std::to_string(num_bits));
+    }
+    const size_t bytes = size * readings.wordsPerReading() * sizeof(uint64_t);
+    return {.run =
+                [readings = shared(std::move(readings))]() {
+                    day03::Readings sorted_readings = *readings;
+                    sorted_readings.sort();
+                    bench::doNotOptimize(*day03::findRating(sorted_readings, true) ^
+                                         *day03::findRating(sorted_readings, false));
+                },
+            .elements = size,
+            .bytes = bytes};
+}
+
+// Boards of a real input: each holds 25 of the numbers 0-99, which are all drawn
+std::vector<day04::Board> makeBoards(Rng& rng, const size_t size) {
+    std::vector<int> numbers(100);
+    std::iota(numbers.begin(), numbers.end(), 0);
+    std::vector<day04::Board> boards(size);
+    for (day04::Board& board : boards) {
+        std::shuffle(numbers.begin(), numbers.end(), rng);
+        std::copy_n(numbers.begin(), board.numbers.size(), board.numbers.begin());
+    }
+    return boards;
+}
+
+day04::DrawRanks makeDraws(Rng& rng) {
+    std::vector<int> draws(100);
+    std::iota(draws.begin(), draws.end(), 0);
+    std::shuffle(draws.begin(), draws.end(), rng);
+    return day04::DrawRanks(std::move(draws));
+}
+
+// The first and last winner as BingoSimulator plays the draws, and the sums of their unmarked
+// numbers when they win
+std::tuple<day04::Winners, int, int> simulateWinners(const std::vector<day04::Board>& boards,
+                                                     const day04::DrawRanks& ranks) {
+    day04::BingoSimulator simulator(boards);
+    day04::Winners winners;
+    for (size_t rank = 0; rank < ranks.numDraws(); ++rank) {
+        for (const size_t board : simulator.draw(ranks.draw(static_cast<int>(rank)))) {
+            winners.add(board, static_cast<int>(rank));
+        }
+    }
+    // boards are not marked any further once they have won
+    auto sum_unmarked = [&boards, &simulator](const size_t board) {
+        return day04::sumUnmarked(boards[board], simulator.marked(board));
+    };
+    return {winners, sum_unmarked(winners.first.board), sum_unmarked(winners.last.board)};
+}
+
+bench::Case findWinners(const size_t size, const size_t num_threads) {
+    Rng rng(4);
+    auto ranks = shared(makeDraws(rng));
+    auto boards = shared(makeBoards(rng, size));
+    auto pool = std::make_shared<aoc::ThreadPool>(num_threads - 1);
+    const day04::Winners winners = day04::findWinners(*boards, *ranks, *pool);
+    bench::checkAgrees(
+        std::tuple(winners,
+                   day04::sumUnmarked((*boards)[winners.first.board], *ranks, winners.first.time),
+                   day04::sumUnmarked((*boards)[winners.last.board], *ranks, winners.last.time)),
+        simulateWinners(*boards, *ranks), "findWinners with win times");
+    return {.run =
+                [boards, ranks, pool]() {
+                    bench::doNotOptimize(day04::findWinners(*boards, *ranks, *pool).last.board);
+                },
+            .elements = size,
+            .bytes = size * sizeof(day04::Board)};
+}
+
+// The replay of the draws as day04 did it before BingoSimulator: boards mark drawn numbers by
+// negating them and count the matches of each line, and the fields of a number are looked up
+// in a hashmap
+struct HashmapBoard {
+    std::array<std::array<int, 5>, 5> numbers;
+    std::array<int, 5> matches_in_row;
+    std::array<int, 5> matches_in_col;
+};
+
+struct BoardField {
+    int board_index;
+    int row;
+    int col;
+};
+
+size_t simulateHashmap(const std::vector<day04::Board>& input_boards,
+                       const std::vector<int>& draws) {
+    std::vector<HashmapBoard> boards;
+    for (const day04::Board& board : input_boards) {
+        HashmapBoard& hashmap_board = boards.emplace_back(HashmapBoard{});
+        for (int cell = 0; cell < 25; ++cell) {
+            hashmap_board.numbers[cell / 5][cell % 5] = board.numbers[cell];
+        }
+    }
+    std::unordered_map<int, std::vector<BoardField>> fields_by_number;
+    for (int board_index = 0; board_index < static_cast<int>(boards.size()); ++board_index) {
+        for (int row = 0; row < 5; ++row) {
+            for (int col = 0; col < 5; ++col) {
+                fields_by_number[boards[board_index].numbers[row][col]].push_back(
+                    {board_index, row, col});
+            }
+        }
+    }
+
+    std::vector<bool> board_won(boards.size(), false);
+    size_t num_boards_won = 0;
+    for (const int num : draws) {
+        auto fields = fields_by_number.find(num);
+        if (fields == fields_by_number.end()) continue;
+        for (const BoardField& field : fields->second) {
+            if (board_won[field.board_index]) continue;
+            HashmapBoard& board = boards[field.board_index];
+            board.numbers[field.row][field.col] *= -1;
+            ++board.matches_in_row[field.row];
+            ++board.matches_in_col[field.col];
+            if (board.matches_in_row[field.row] == 5 || board.matches_in_col[field.col] == 5) {
+                board_won[field.board_index] = true;
+                ++num_boards_won;
+            }
+        }
+        fields->second.clear();
+        if (num_boards_won == boards.size()) break;
+    }
+    return num_boards_won;
+}
+
+size_t simulateMasks(const std::vector<day04::Board>& boards, const std::vector<int>& draws) {
+    day04::BingoSimulator simulator(boards);
+    size_t num_boards_won = 0;
+    for (const int num : draws) {
+        num_boards_won += simulator.draw(num).size();
+        if (num_boards_won == boards.size()) break;
+    }
+    return num_boards_won;
+}
+
+// Playing all draws, including building the index
+template <size_t (*simulate)(const std::vector<day04::Board>&, const std::vector<int>&)>
+bench::Case simulateDraws(const size_t size) {
+    Rng rng(4);
+    std::vector<int> draws(100);
+    std::iota(draws.begin(), draws.end(), 0);
+    std::shuffle(draws.begin(), draws.end(), rng);
+    auto boards = shared(makeBoards(rng, size));
+    bench::checkAgrees(simulate(*boards, draws), simulateMasks(*boards, draws),
+                       "replay of the draws");
+    return {.run =
+                [boards, draws = shared(std::move(draws))]() {
+                    bench::doNotOptimize(simulate(*boards, *draws));
+                },
+            .elements = size,
+            .bytes = size * sizeof(day04::Board)};
+}
+
+std::vector<bench::Benchmark> findWinnersBenchmarks() {
+    std::vector<bench::Benchmark> benchmarks = {
+        {"day04 simulate hashmap", "board", {1'000, 100'000, 1'000'000},
+         simulateDraws<simulateHashmap>},
+        {"day04 simulate masks", "board", {1'000, 100'000, 1'000'000},
+         simulateDraws<simulateMasks>},
+    };
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t num_threads = 1;; num_threads = std::min(num_threads * 2, max_threads)) {
+        benchmarks.push_back({"day04 findWinners " + std::to_string(num_threads) + " thr",
+                              "board",
+                              {1'000, 100'000, 1'000'000},
+                              [num_threads](const size_t size) {
+                                  return findWinners(size, num_threads);
+                              }});
+        if (num_threads == max_threads) break;
+    }
+    return benchmarks;
+}
+
+// Lines like those of gen: up to max_length long, or across the plane if max_length is 0
+std::vector<day05::Line> makeVents(const size_t size, const int side, const int max_length) {
+    Rng rng(5);
+    std::vector<day05::Line> lines;
+    lines.reserve(size);
+    for (size_t i = 0; i < size; ++i) {
+        const int x1 = uniform(rng, 0, side - 1);
+        const int y1 = uniform(rng, 0, side - 1);
+        const int dx = uniform(rng, 0, 1) * 2 - 1;
+        const int dy = uniform(rng, 0, 1) * 2 - 1;
+        // as long as the line stays inside the plane
+        const int max_x = std::min(dx > 0 ? side - 1 - x1 : x1, max_length > 0 ? max_length : side);
+        const int max_y = std::min(dy > 0 ? side - 1 - y1 : y1, max_length > 0 ? max_length : side);
+        switch (uniform(rng, 0, 2)) {
+            case 0:
+                lines.push_back({{x1, y1}, {x1 + dx * uniform(rng, 0, max_x), y1}});
+                break;
+            case 1:
+                lines.push_back({{x1, y1}, {x1, y1 + dy * uniform(rng, 0, max_y)}});
+                break;
+            default:
+                const int length = uniform(rng, 0, std::min(max_x, max_y));
+                lines.push_back({{x1, y1}, {x1 + dx * length, y1 + dy * length}});
+        }
+    }
+    return lines;
+}
+
+// Each engine is checked against the one countOverlaps chooses for the lines, so on every input
+// all engines are compared with the same count
+void checkOverlaps(const std::vector<day05::Line>& lines, const int64_t overlaps,
+                   const std::string& engine) {
+    bench::checkAgrees(overlaps, day05::countOverlaps(lines), "countOverlaps " + engine);
+}
+
+// On the plane of gen, whose area grows with the number of lines
+bench::Case countOverlaps(const size_t size, const day05::Engine engine) {
+    const int side = static_cast<int>(1000 * std::sqrt(size / 500.0));
+    auto lines = shared(makeVents(size, side, 0));
+    checkOverlaps(*lines, day05::countOverlaps(*lines, engine), day05::engineName(engine));
+    return {.run = [lines, engine]() {
+                bench::doNotOptimize(day05::countOverlaps(*lines, engine));
+            },
+            .elements = size};
+}
+
+// Lines of up to 1000 points on a plane too large for a grid
+bench::Case countOverlapsSparse(const size_t size, const day05::Engine engine) {
+    auto lines = shared(makeVents(size, 10'000'000, 1'000));
+    checkOverlaps(*lines, day05::countOverlaps(*lines, engine), day05::engineName(engine));
+    return {.run = [lines, engine]() {
+                bench::doNotOptimize(day05::countOverlaps(*lines, engine));
+            },
+            .elements = size};
+}
+
+// Tiled rasterisation on the plane of gen
+bench::Case countOverlapsParallel(const size_t size, const size_t num_threads) {
+    const int side = static_cast<int>(1000 * std::sqrt(size / 500.0));
+    auto pool = std::make_shared<aoc::ThreadPool>(num_threads - 1);
+    auto lines = shared(makeVents(size, side, 0));
+    checkOverlaps(*lines, day05::countOverlaps(*lines, *pool), "tiled");
+    return {.run = [lines, pool]() {
+                bench::doNotOptimize(day05::countOverlaps(*lines, *pool));
+            },
+            .elements = size};
+}
+
+std::vector<bench::Benchmark> countOverlapsBenchmarks() {
+    using day05::Engine;
+    std::vector<bench::Benchmark> benchmarks;
+    for (const Engine engine : {Engine::HASHMAP, Engine::DENSE_GRID, Engine::SWEEP_LINE}) {
+        benchmarks.push_back({std::string("day05 countOverlaps ") + day05::engineName(engine),
+                              "line",
+                              {500, 2'000, 10'000},
+                              [engine](const size_t size) { return countOverlaps(size, engine); }});
+    }
+    for (const Engine engine : {Engine::HASHMAP, Engine::SWEEP_LINE}) {
+        benchmarks.push_back(
+            {std::string("day05 sparse ") + day05::engineName(engine),
+             "line",
+             engine == Engine::HASHMAP ? std::vector<size_t>{1'000, 100'000}
+                                       : std::vector<size_t>{1'000, 100'000, 1'000'000},
+             [engine](const size_t size) { return countOverlapsSparse(size, engine); }});
+    }
+    const size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (size_t num_threads = 1;; num_threads = std::min(num_threads * 2, max_threads)) {
+        benchmarks.push_back({"day05 countOverlaps tiled " + std::to_string(num_threads) + " thr",
+                              "line",
+                              {500, 2'000, 10'000, 100'000},
+                              [num_threads](const size_t size) {
+                                  return countOverlapsParallel(size, num_threads);
+                              }});
+        if (num_threads == max_threads) break;
+    }
+    return benchmarks;
+}
+
+bench::Case parseLine(const size_t size) {
+    Rng rng(5);
+    std::vector<std::string> lines;
+    for (size_t i = 0; i < size; ++i) {
+        lines.push_back(std::to_string(uniform(rng, 0, 999)) + "," +
+                        std::to_string(uniform(rng, 0, 999)) + " -> " +
+                        std::to_string(uniform(rng, 0, 999)) + "," +
+                        std::to_string(uniform(rng, 0, 999)));
+    }
+    return {.run =
+                [lines = shared(std::move(lines))]() {
+                    int64_t sum = 0;
+                    for (const std::string& line : *lines) {
+                        const day05::Line parsed = day05::parseLine(line);
+                        sum += parsed.start.x + parsed.end.y;
+                    }
+                    bench::doNotOptimize(sum);
+                },
+            .elements = size};
+}
+
+// The initial timers of a puzzle input: 300 fish with timers 1 to 5
+std::array<size_t, day06::NUM_TIMERS> makeTimers() {
+    Rng rng(6);
+    std::array<size_t, day06::NUM_TIMERS> timers{};
+    for (int fish = 0; fish < 300; ++fish) ++timers[uniform(rng, 1, 5)];
+    return timers;
+}
+
+// The count of simulate_days, as the reference of the other day06 kernels up to about 440 days
+size_t simulatedCount(const std::array<size_t, day06::NUM_TIMERS>& timers, const int days) {
+    const auto after = day06::simulate_days(timers, days);
+    return std::accumulate(after.begin(), after.end(), size_t{0});
+}
+
+bench::Case simulateDays(const size_t size) {
+    return {.run = [timers = makeTimers(), size]() {
+                bench::doNotOptimize(day06::simulate_days(timers, static_cast<int>(size))[0]);
+            },
+            .elements = size};
+}
+
+// A dot product with the growth table up to 256 days, beyond it an exact FishCounter. The 300
+// fish of makeTimers outgrow size_t after about 450 days, so longer periods are capped.
+bench::Case countFish(const size_t size) {
+    const int days = static_cast<int>(std::min<size_t>(size, 400));
+    bench::checkAgrees(day06::count_fish(makeTimers(), days), simulatedCount(makeTimers(), days),
+                       "count_fish");
+    return {.run = [timers = makeTimers(), days]() {
+                bench::doNotOptimize(day06::count_fish(timers, days));
+            },
+            .elements = static_cast<size_t>(days)};
+}
+
+// Counting exactly after size days with the matrix powers, including squaring them
+bench::Case countFishExact(const size_t size) {
+    if (size <= 400) {
+        day06::FishCounter counter(day06::ExactArithmetic{}, makeTimers());
+        bench::checkAgrees(counter.count_after(size),
+                           day06::BigUint(simulatedCount(makeTimers(), static_cast<int>(size))),
+                           "FishCounter exact");
+    }
+    return {.run = [timers = makeTimers(), size]() {
+                day06::FishCounter counter(day06::ExactArithmetic{}, timers);
+                bench::doNotOptimize(counter.count_after(size).to_string());
+            },
+            .elements = size};
+}
+
+// value mod modulus, from its decimal digits
+uint64_t reduceDecimal(const std::string& value, const uint64_t modulus) {
+    uint64_t remainder = 0;
+    for (const char digit : value) remainder = (remainder * 10 + (digit - '0')) % modulus;
+    return remainder;
+}
+
+// A batch of size queries of up to 10^18 days modulo a prime, sharing the matrix powers
+bench::Case countFishModular(const size_t size) {
+    constexpr uint64_t MODULUS = 1'000'000'007;
+    day06::FishCounter modular(day06::ModularArithmetic(MODULUS), makeTimers());
+    day06::FishCounter exact(day06::ExactArithmetic{}, makeTimers());
+    for (const uint64_t days : {0, 80, 256, 1'000, 10'000}) {
+        bench::checkAgrees(modular.count_after(days),
+                           reduceDecimal(exact.count_after(days).to_string(), MODULUS),
+                           "FishCounter mod");
+    }
+
+    Rng rng(6);
+    std::vector<uint64_t> days(size);
+    for (uint64_t& day : days) day = rng() % 1'000'000'000'000'000'000;
+    return {.run = [timers = makeTimers(), days = shared(std::move(days))]() {
+                day06::FishCounter counter(day06::ModularArithmetic(MODULUS), timers);
+                bench::doNotOptimize(counter.count_after(*days).back());
+            },
+            .elements = size};
+}
+
+// size is the side length of the square grid
+bench::Case lowestCostDijkstra(const size_t size) {
+    Rng rng(15);
+    std::vector<std::vector<int>> cost(size, std::vector<int>(size));
+    for (auto& row : cost) {
+        for (int& c : row) c = uniform(rng, 1, 9);
+    }
+    return {.run =
+                [cost = shared(std::move(cost))]() {
+                    bench::doNotOptimize(day15::lowestCostDijkstra(*cost));
+                },
+            .elements = size * size};
+}
+
+// Transmission with an operator packet of about sqrt(size) operator packets, each with about
+// sqrt(size) literals. Returns the bits and the number of packets.
+std::pair<std::vector<bool>, size_t> makeTransmission(const size_t size) {
+    Rng rng(16);
+    std::vector<bool> bits;
+    auto append = [&bits](const uint64_t value, const int num_bits) {
+        for (int bit = num_bits - 1; bit >= 0; --bit) bits.push_back((value >> bit) & 1);
+    };
+    auto append_operator = [&append](const int type_id, const size_t num_sub_packets) {
+        append(0, 3);  // version
+        append(type_id, 3);
+        append(1, 1);  // length type: number of sub-packets
+        append(num_sub_packets, 11);
+    };
+
+    const size_t per_group = std::clamp<size_t>(std::sqrt(size), 1, 2047);
+    const size_t groups = std::clamp<size_t>((size + per_group - 1) / per_group, 1, 2047);
+    size_t packets = 1;
+    append_operator(0, groups);  // sum
+    for (size_t group = 0; group < groups; ++group) {
+        append_operator(uniform(rng, 0, 3) == 1 ? 0 : uniform(rng, 2, 3), per_group);  // no product
+        for (size_t i = 0; i < per_group; ++i) {
+            append(uniform(rng, 0, 7), 3);
+            append(4, 3);  // literal
+            const int groups_of_value = uniform(rng, 1, 4);
+            for (int j = 0; j < groups_of_value; ++j) {
+                append(j + 1 < groups_of_value ? 1 : 0, 1);
+                append(uniform(rng, 0, 15), 4);
+            }
+        }
+        packets += per_group + 1;
+    }
+    return {bits, packets};
+}
+
+bench::Case parsePacket(const size_t size) {
+    auto [bits, packets] = makeTransmission(size);
+    return {.run =
+                [bits = shared(std::move(bits))]() {
+                    size_t idx = 0;
+                    const day16::Packet packet = day16::parse_packet(*bits, idx);
+                    bench::doNotOptimize(packet.packets.size());
+                },
+            .elements = packets};
+}
+
+bench::Case evaluate(const size_t size) {
+    auto [bits, packets] = makeTransmission(size);
+    size_t idx = 0;
+    return {.run = [packet = shared(day16::parse_packet(bits, idx))]() {
+                bench::doNotOptimize(day16::evaluate(*packet));
+            },
+            .elements = packets};
+}
+
+// Random snailfish numbers which are already reduced
+std::vector<std::string> makeSnailfishNumbers(const size_t size) {
+    Rng rng(18);
+    auto number = [&rng](std::string& s, const int depth, auto& self) -> void {
+        if (depth > 0 && (depth == 4 || uniform(rng, 0, 99) < 35)) {
+            s += std::to_string(uniform(rng, 0, 9));
+            return;
+        }
+        s += "[";
+        self(s, depth + 1, self);
+        s += ",";
+        self(s, depth + 1, self);
+        s += "]";
+    };
+
+    std::vector<std::string> numbers(size);
+    for (std::string& s : numbers) number(s, 0, number);
+    return numbers;
+}
+
+// Sum of size numbers, like day18 part 1
+bench::Case add(const size_t size) {
+    const auto strings = shared(makeSnailfishNumbers(size));
+    const auto numbers = std::make_shared<std::vector<day18::Number::UPtr>>();
+    return {.run =
+                [numbers]() {
+                    day18::Number::UPtr sum = std::move(numbers->front());
+                    for (size_t i = 1; i < numbers->size(); ++i) {
+                        sum = day18::add(std::move(sum), std::move((*numbers)[i]));
+                    }
+                    bench::doNotOptimize(sum->magnitude());
+                },
+            .elements = size - 1,
+            .setup =
+                [strings, numbers]() {
+                    numbers->clear();
+                    for (const std::string& s : *strings) {
+                        numbers->push_back(day18::Number::makeFromString(s));
+                    }
+                }};
+}
+
+// Reduction of size pairs of two numbers, like each addition of day18 part 2
+bench::Case reduce(const size_t size) {
+    const auto strings = shared(makeSnailfishNumbers(size + 1));
+    const auto pairs = std::make_shared<std::vector<day18::Number::UPtr>>();
+    return {.run =
+                [pairs]() {
+                    int64_t sum = 0;
+                    for (const auto& pair : *pairs) {
+                        day18::reduce(pair.get());
+                        sum += pair->magnitude();
+                    }
+                    bench::doNotOptimize(sum);
+                },
+            .elements = size,
+            .setup =
+                [strings, pairs]() {
+                    pairs->clear();
+                    for (size_t i = 0; i + 1 < strings->size(); ++i) {
+                        auto first = day18::Number::makeFromString((*strings)[i]);
+                        auto second = day18::Number::makeFromString((*strings)[i + 1]);
+                        pairs->push_back(
+                            day18::Number::makePair(std::move(first), std::move(second)));
+                    }
+                }};
+}
+
+// Beacons seen by one scanner, as in the real input
+std::vector<day19::Vec3> makeBeacons(Rng& rng, const size_t count) {
+    std::vector<day19::Vec3> beacons(count);
+    for (auto& beacon : beacons) {
+        beacon = {uniform(rng, -1000, 1000), uniform(rng, -1000, 1000), uniform(rng, -1000, 1000)};
+    }
+    return beacons;
+}
+
+// size is the number of beacons of each scanner; the second one sees the same beacons shifted
+bench::Case bestMatch(const size_t size) {
+    Rng rng(19);
+    std::vector<day19::Vec3> points1 = makeBeacons(rng, size);
+    std::vector<day19::Vec3> points2 = points1;
+    for (auto& point : points2) point = {point[0] + 68, point[1] - 1246, point[2] - 43};
+    return {.run = [points1 = shared(std::move(points1)), points2 = shared(std::move(points2))]() {
+                bench::doNotOptimize(day19::best_match(*points1, *points2).count_matches);
+            },
+            .elements = size * size};
+}
+
+// size is the number of scanners with 26 beacons each
+bench::Case compareBeacons(const size_t size) {
+    Rng rng(19);
+    std::vector<std::vector<day19::Vec3>> scanner_data;
+    for (size_t i = 0; i < size; ++i) scanner_data.push_back(makeBeacons(rng, 26));
+    return {.run =
+                [scanner_data = shared(std::move(scanner_data))]() {
+                    bench::doNotOptimize(day19::compare_beacons(*scanner_data).size());
+                },
+            .elements = size * (size - 1) / 2 * 24};
+}
+
+const std::vector<bench::Benchmark> BENCHMARKS = {
+    {"day03 pack", "reading", {1'000, 100'000, 1'000'000}, packReadings},
+    {"day03 countOnes/12", "reading", {1'000, 1'000'000, 10'000'000},
+     [](const size_t size) { return countOnes(size, 12); }},
+    {"day03 countOnes/100", "reading", {1'000, 1'000'000, 10'000'000},
+     [](const size_t size) { return countOnes(size, 100); }},
+    {"day03 ratings/48", "reading", {1'000, 1'000'000, 10'000'000},
+     [](const size_t size) { return ratings(size, 48); }},
+    {"day03 ratings/100", "reading", {1'000, 1'000'000, 10'000'000},
+     [](const size_t size) { return ratings(size, 100); }},
+    {"day05 parseLine", "line", {1'000, 100'000, 1'000'000}, parseLine},
+    {"day06 simulate_days", "day", {80, 256, 10'000, 1'000'000}, simulateDays},
+    {"day06 count_fish", "day", {80, 256, 400}, countFish},
+    {"day06 FishCounter exact", "day", {256, 10'000, 100'000}, countFishExact},
+    {"day06 FishCounter mod", "query", {1, 100, 10'000}, countFishModular},
+    {"day15 dijkstra", "cell", {50, 200, 1'000}, lowestCostDijkstra},
+    {"day16 parse_packet", "packet", {1'000, 100'000, 1'000'000}, parsePacket},
+    {"day16 evaluate", "packet", {1'000, 100'000, 1'000'000}, evaluate},
+    {"day18 add", "addition", {10, 100, 1'000}, add},
+    {"day18 reduce", "pair", {10, 100, 1'000}, reduce},
+    {"day19 best_match", "point pair", {26, 100, 400}, bestMatch},
+    {"day19 compare_beacons", "best_match", {4, 10, 30}, compareBeacons},
+};
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " [FILTER] [--reps N] [--scale S]\n"
+              << "Runs the benchmarks whose name contains FILTER, with all sizes times S\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    bench::Options options;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--reps" && i + 1 < argc) {
+                options.reps = aoc::to_number<int>(argv[++i]);
+            } else if (arg == "--scale" && i + 1 < argc) {
+                options.scale = aoc::to_number<double>(argv[++i]);
+            } else if (!arg.starts_with("-") && options.filter.empty()) {
+                options.filter = arg;
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << "\n";
+        usage(argv[0]);
+        return 1;
+    }
+    if (options.reps < 1 || options.scale <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::cout << "Median of " << options.reps << " runs per size\n";
+    std::vector<bench::Benchmark> benchmarks = BENCHMARKS;
+    for (auto make_benchmarks :
+         {countIncreasesBenchmarks, followCommandsBenchmarks, findWinnersBenchmarks,
+          countOverlapsBenchmarks}) {
+        const std::vector<bench::Benchmark> day_benchmarks = make_benchmarks();
+        benchmarks.insert(benchmarks.end(), day_benchmarks.begin(), day_benchmarks.end());
+    }
+    // by day, as the names start with it
+    std::stable_sort(benchmarks.begin(), benchmarks.end(),
+                     [](const bench::Benchmark& lhs, const bench::Benchmark& rhs) {
+                         return lhs.name.substr(0, 5) < rhs.name.substr(0, 5);
+                     });
+    try {
+        bench::runBenchmarks(benchmarks, options, std::cout);
+    } catch (const std::logic_error& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
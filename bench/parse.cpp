@@ -0,0 +1,216 @@
+// Compare the per-day string splitting which was copied into every day with aoc::split on each
+// day's input format. Inputs are the puzzle inputs repeated many times and held in memory, so only
+// tokenizing and number conversion is measured.
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc/split.h"
+#include "bench.h"
+
+namespace legacy {
+
+// string split like in Python, nearly identical to https://stackoverflow.com/a/46931770/997151
+std::vector<std::string> split(const std::string& s, const std::string& delimiter) {
+    size_t pos_start = 0;
+    size_t pos_end{};
+    std::vector<std::string> res;
+
+    while ((pos_end = s.find(delimiter, pos_start)) != std::string::npos) {
+        std::string token = s.substr(pos_start, pos_end - pos_start);
+        res.emplace_back(std::move(token));
+        pos_start = pos_end + delimiter.length();
+    }
+
+    res.emplace_back(s.substr(pos_start));
+    return res;
+}
+
+}  // namespace legacy
+
+// How to tokenize a line of one day's input, once with each implementation.
+// Both return a checksum over the parsed values so the results can be compared.
+struct Format {
+    const char* day;
+    const char* input;
+    int64_t (*legacy_parse)(const std::string& line);
+    int64_t (*aoc_parse)(const std::string& line);
+};
+
+int64_t sumNumbersLegacy(const std::string& line, const std::string& delimiter) {
+    int64_t sum = 0;
+    for (const std::string& s : legacy::split(line, delimiter)) sum += std::stoi(s);
+    return sum;
+}
+
+int64_t sumNumbers(const std::string_view line, const std::string_view delimiter) {
+    int64_t sum = 0;
+    for (const std::string_view s : aoc::split(line, delimiter)) sum += aoc::to_number<int>(s);
+    return sum;
+}
+
+int64_t sumChars(const std::string_view s) {
+    int64_t sum = 0;
+    for (const char c : s) sum += c;
+    return sum;
+}
+
+const std::vector<Format> FORMATS = {
+    {"day04", "day04-giant-squid/input1.txt",
+     [](const std::string& line) -> int64_t {
+         if (line.find(',') == std::string::npos) return 0;  // only the draws are split
+         return sumNumbersLegacy(line, ",");
+     },
+     [](const std::string& line) -> int64_t {
+         if (line.find(',') == std::string::npos) return 0;
+         return sumNumbers(line, ",");
+     }},
+    {"day05", "day05-hydrothermal-venture/input1.txt",
+     [](const std::string& line) -> int64_t {
+         int64_t sum = 0;
+         for (const std::string& point : legacy::split(line, " -> ")) {
+             sum += sumNumbersLegacy(point, ",");
+         }
+         return sum;
+     },
+     [](const std::string& line) -> int64_t {
+         const auto [start, end] = aoc::split_n<2>(line, " -> ");
+         return sumNumbers(start, ",") + sumNumbers(end, ",");
+     }},
+    {"day06", "day06-lanternfish/input1.txt",
+     [](const std::string& line) -> int64_t { return sumNumbersLegacy(line, ","); },
+     [](const std::string& line) -> int64_t { return sumNumbers(line, ","); }},
+    {"day07", "day07-the-treachery-of-whales/input1.txt",
+     [](const std::string& line) -> int64_t { return sumNumbersLegacy(line, ","); },
+     [](const std::string& line) -> int64_t { return sumNumbers(line, ","); }},
+    {"day08", "day08-seven-segment-search/input.txt",
+     [](const std::string& line) -> int64_t {
+         int64_t sum = 0;
+         const auto splitted = legacy::split(line, " | ");
+         for (const std::string& s : legacy::split(splitted.at(0), " ")) sum += sumChars(s);
+         for (const std::string& s : legacy::split(splitted.at(1), " ")) sum += sumChars(s);
+         return sum;
+     },
+     [](const std::string& line) -> int64_t {
+         int64_t sum = 0;
+         const auto [patterns, outputs] = aoc::split_n<2>(line, " | ");
+         for (const std::string_view s : aoc::split_n<10>(patterns, " ")) sum += sumChars(s);
+         for (const std::string_view s : aoc::split_n<4>(outputs, " ")) sum += sumChars(s);
+         return sum;
+     }},
+    {"day12", "day12-passage-pathing/input.txt",
+     [](const std::string& line) -> int64_t {
+         const auto edge = legacy::split(line, "-");
+         return sumChars(edge[0]) - sumChars(edge[1]);
+     },
+     [](const std::string& line) -> int64_t {
+         const auto [from, to] = aoc::split_n<2>(line, "-");
+         return sumChars(from) - sumChars(to);
+     }},
+    {"day13", "day13-transparent-origami/input.txt",
+     [](const std::string& line) -> int64_t {
+         if (line.empty()) return 0;
+         if (line[0] == 'f') {
+             const auto splitted = legacy::split(line, "fold along ");
+             return splitted.at(1)[0] + std::stoi(legacy::split(splitted.at(1), "=").at(1));
+         }
+         return sumNumbersLegacy(line, ",");
+     },
+     [](const std::string& line) -> int64_t {
+         if (line.empty()) return 0;
+         if (line[0] == 'f') {
+             aoc::FieldReader fields(line);
+             const std::string_view axis = fields.skip("fold along ").next("=");
+             return axis[0] + aoc::to_number<int>(fields.rest());
+         }
+         return sumNumbers(line, ",");
+     }},
+    {"day14", "day14-extended-polymerization/input.txt",
+     [](const std::string& line) -> int64_t {
+         if (line.find(" -> ") == std::string::npos) return 0;
+         const auto splitted = legacy::split(line, " -> ");
+         return sumChars(splitted.at(0)) + splitted.at(1).at(0);
+     },
+     [](const std::string& line) -> int64_t {
+         if (line.find(" -> ") == std::string::npos) return 0;
+         const auto [pair, inserted] = aoc::split_n<2>(line, " -> ");
+         return sumChars(pair) + inserted.at(0);
+     }},
+    {"day17", "day17-trick-shot/input.txt",
+     [](const std::string& line) -> int64_t {
+         using legacy::split;
+         const std::string x_str = split(split(line, "x=").at(1), ", ").at(0);
+         const std::string y_str = split(line, "y=").at(1);
+         return std::stoi(split(x_str, "..").at(0)) + std::stoi(split(x_str, "..").at(1)) +
+                std::stoi(split(y_str, "..").at(0)) + std::stoi(split(y_str, "..").at(1));
+     },
+     [](const std::string& line) -> int64_t {
+         aoc::FieldReader fields(line);
+         int64_t sum = fields.skip("x=").next_number<int>("..");
+         sum += fields.next_number<int>(", ");
+         sum += fields.skip("y=").next_number<int>("..");
+         return sum + aoc::to_number<int>(fields.rest());
+     }},
+    {"day19", "day19-beacon-scanner/input.txt",
+     [](const std::string& line) -> int64_t {
+         if (line.empty() || line.starts_with("--")) return 0;
+         return sumNumbersLegacy(line, ",");
+     },
+     [](const std::string& line) -> int64_t {
+         if (line.empty() || line.starts_with("--")) return 0;
+         const auto [x, y, z] = aoc::split_n<3>(line, ",");
+         return aoc::to_number<int>(x) + aoc::to_number<int>(y) + aoc::to_number<int>(z);
+     }},
+};
+
+int main(int argc, char* argv[]) {
+    const int repeat_input = argc > 1 ? std::stoi(argv[1]) : 1000;
+    const int reps = 5;
+
+    std::cout << "Parsing each input repeated " << repeat_input << " times, median of " << reps
+              << " runs\n";
+    std::cout << std::left << std::setw(8) << "day" << std::right << std::setw(12) << "lines"
+              << std::setw(16) << "legacy ns/line" << std::setw(14) << "aoc ns/line"
+              << std::setw(10) << "speedup\n";
+
+    for (const Format& format : FORMATS) {
+        std::ifstream ifs(std::string(AOC_SOURCE_DIR) + "/" + format.input);
+        if (!ifs) throw std::runtime_error(std::string("Cannot open ") + format.input);
+
+        std::vector<std::string> input_lines;
+        for (std::string line; std::getline(ifs, line);) input_lines.emplace_back(std::move(line));
+
+        std::vector<std::string> lines;
+        lines.reserve(input_lines.size() * repeat_input);
+        for (int i = 0; i < repeat_input; ++i) {
+            lines.insert(lines.end(), input_lines.begin(), input_lines.end());
+        }
+
+        int64_t legacy_checksum = 0;
+        int64_t aoc_checksum = 0;
+        const auto legacy_time = bench::medianTime(reps, [&]() {
+            legacy_checksum = 0;
+            for (const std::string& line : lines) legacy_checksum += format.legacy_parse(line);
+            bench::doNotOptimize(legacy_checksum);
+        });
+        const auto aoc_time = bench::medianTime(reps, [&]() {
+            aoc_checksum = 0;
+            for (const std::string& line : lines) aoc_checksum += format.aoc_parse(line);
+            bench::doNotOptimize(aoc_checksum);
+        });
+        if (legacy_checksum != aoc_checksum) {
+            throw std::logic_error(std::string("Parse results differ for ") + format.day);
+        }
+
+        const double legacy_ns = static_cast<double>(legacy_time.count()) / lines.size();
+        const double aoc_ns = static_cast<double>(aoc_time.count()) / lines.size();
+        std::cout << std::left << std::setw(8) << format.day << std::right << std::setw(12)
+                  << lines.size() << std::fixed << std::setprecision(1) << std::setw(16)
+                  << legacy_ns << std::setw(14) << aoc_ns << std::setw(9) << legacy_ns / aoc_ns
+                  << "x\n";
+    }
+}
@@ -0,0 +1,151 @@
+// Compare reading the day01, day02 and day03 inputs with std::ifstream (std::getline / operator>>)
+// and with aoc::LineReader, mapped and streamed. The inputs are repeated many times and written to
+// a temporary file first, so the first run of every reader may still hit the disk.
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+#include "bench.h"
+
+struct Reader {
+    const char* name;
+    int64_t (*read)(const std::string& path);  // returns a checksum over the parsed values
+};
+
+struct Format {
+    const char* day;
+    const char* input;
+    std::vector<Reader> readers;
+};
+
+// Parse a line of a day's input into a checksum
+using LineParser = int64_t (*)(std::string_view line);
+
+template <LineParser parse_line>
+int64_t readMapped(const std::string& path) {
+    aoc::LineReader in(path);
+    int64_t sum = 0;
+    std::string_view line;
+    while (in.getline(line)) sum += parse_line(line);
+    return sum;
+}
+
+template <LineParser parse_line>
+int64_t readStreamed(const std::string& path) {
+    std::ifstream ifs(path, std::ios::binary);
+    aoc::LineReader in(ifs);
+    int64_t sum = 0;
+    std::string_view line;
+    while (in.getline(line)) sum += parse_line(line);
+    return sum;
+}
+
+template <LineParser parse_line>
+int64_t readGetline(const std::string& path) {
+    std::ifstream ifs(path);
+    int64_t sum = 0;
+    std::string line;
+    while (std::getline(ifs, line)) sum += parse_line(line);
+    return sum;
+}
+
+int64_t parseNumber(const std::string_view line) { return aoc::to_number<int>(line); }
+
+int64_t parseCommand(const std::string_view line) {
+    const auto [cmd, units] = aoc::split_n<2>(line, " ");
+    return cmd[0] * aoc::to_number<int64_t>(units);
+}
+
+int64_t parseBits(const std::string_view line) {
+    int64_t sum = 0;
+    for (const char c : line) sum += c == '1';
+    return sum;
+}
+
+template <LineParser parse_line>
+std::vector<Reader> lineReaders() {
+    return {{"getline", readGetline<parse_line>},
+            {"mapped", readMapped<parse_line>},
+            {"streamed", readStreamed<parse_line>}};
+}
+
+const std::vector<Format> FORMATS = {
+    {"day01", "day01-sonar-sweep/input1.txt",
+     [] {
+         auto readers = lineReaders<parseNumber>();
+         readers.insert(readers.begin(), {"operator>>", [](const std::string& path) -> int64_t {
+                                              std::ifstream ifs(path);
+                                              int64_t sum = 0;
+                                              int value{};
+                                              while (ifs >> value) sum += value;
+                                              return sum;
+                                          }});
+         return readers;
+     }()},
+    {"day02", "day02-dive/input1.txt",
+     [] {
+         auto readers = lineReaders<parseCommand>();
+         readers.insert(readers.begin(), {"operator>>", [](const std::string& path) -> int64_t {
+                                              std::ifstream ifs(path);
+                                              int64_t sum = 0;
+                                              std::string cmd;
+                                              int64_t units{};
+                                              while (ifs >> cmd >> units) sum += cmd[0] * units;
+                                              return sum;
+                                          }});
+         return readers;
+     }()},
+    {"day03", "day03-binary-diagnostic/input1.txt", lineReaders<parseBits>()},
+};
+
+int main(int argc, char* argv[]) {
+    const int repeat_input = argc > 1 ? std::stoi(argv[1]) : 10000;
+    const int reps = 5;
+    const std::filesystem::path tmp_path =
+        std::filesystem::temp_directory_path() / "aoc_bench_read.txt";
+
+    std::cout << "Reading each input repeated " << repeat_input << " times, median of " << reps
+              << " runs\n";
+    std::cout << std::left << std::setw(8) << "day" << std::setw(12) << "reader" << std::right
+              << std::setw(12) << "MB" << std::setw(12) << "ms" << std::setw(10) << "GB/s\n";
+
+    for (const Format& format : FORMATS) {
+        {
+            std::ifstream ifs(std::string(AOC_SOURCE_DIR) + "/" + format.input);
+            if (!ifs) throw std::runtime_error(std::string("Cannot open ") + format.input);
+            const std::string content{std::istreambuf_iterator<char>(ifs), {}};
+            std::ofstream ofs(tmp_path, std::ios::binary);
+            for (int i = 0; i < repeat_input; ++i) ofs << content;
+        }
+        const double bytes = static_cast<double>(std::filesystem::file_size(tmp_path));
+
+        std::optional<int64_t> expected;
+        for (const Reader& reader : format.readers) {
+            int64_t checksum = 0;
+            const auto time = bench::medianTime(reps, [&]() {
+                checksum = reader.read(tmp_path.string());
+                bench::doNotOptimize(checksum);
+            });
+            if (expected && *expected != checksum) {
+                throw std::logic_error(std::string("Read results differ for ") + format.day);
+            }
+            expected = checksum;
+
+            std::cout << std::left << std::setw(8) << format.day << std::setw(12) << reader.name
+                      << std::right << std::fixed << std::setprecision(1) << std::setw(12)
+                      << bytes / 1e6 << std::setw(12) << time.count() / 1e6
+                      << std::setprecision(2) << std::setw(9) << bytes / time.count() << "\n";
+        }
+    }
+    std::filesystem::remove(tmp_path);
+}
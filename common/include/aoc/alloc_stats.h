@@ -0,0 +1,49 @@
+#pragma once
+
+// Opt-in accounting of heap allocations.
+// With the AOC_ALLOC_STATS CMake option, aoc_common replaces the global operator new/delete and
+// counts the allocations of every thread. Without it AllocScope always reports zeros.
+
+#include <cstdint>
+
+namespace aoc {
+
+#ifdef AOC_ALLOC_STATS
+constexpr bool ALLOC_STATS_ENABLED = true;
+#else
+constexpr bool ALLOC_STATS_ENABLED = false;
+#endif
+
+struct AllocStats {
+    uint64_t count{0};      // number of allocations
+    uint64_t bytes{0};      // sum of the requested sizes
+    uint64_t peak_live{0};  // most bytes allocated at once, on top of what was live at the start
+};
+
+// Measures the allocations of the calling thread from construction until stats() is called.
+// Allocations of tasks which are run by other threads are not included.
+#ifdef AOC_ALLOC_STATS
+class AllocScope {
+   public:
+    AllocScope();
+    ~AllocScope();
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+    AllocStats stats() const;
+
+   private:
+    uint64_t m_start_count;
+    uint64_t m_start_bytes;
+    int64_t m_start_live;
+    int64_t m_outer_peak;  // peak of an enclosing scope, restored on destruction
+};
+#else
+class AllocScope {
+   public:
+    AllocStats stats() const { return {}; }
+};
+#endif
+
+}  // namespace aoc
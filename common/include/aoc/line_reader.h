@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace aoc {
+
+// Reads puzzle input line by line without copying it into strings.
+// Regular files are memory-mapped and lines are views into the mapping. Everything else (stdin,
+// pipes, streams) is read in chunks into a buffer, and lines are views into that buffer.
+class LineReader {
+   public:
+    // Map the file at path, or stream it if it cannot be mapped. "-" streams stdin.
+    explicit LineReader(const std::string& path);
+    // Stream from is, which must outlive the reader
+    explicit LineReader(std::istream& is);
+    ~LineReader();
+
+    LineReader(const LineReader&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+
+    // Get the next line without its '\n', like std::getline.
+    // Views of mapped input stay valid as long as the reader; views of streamed input only until
+    // the next call.
+    /// @return false if there are no more lines
+    bool getline(std::string_view& line);
+
+    bool isMapped() const { return m_map != nullptr; }
+
+   private:
+    // mapped input
+    void* m_map{nullptr};
+    size_t m_map_size{0};
+
+    // streamed input
+    std::unique_ptr<std::ifstream> m_owned_stream;  // if the reader opened the stream itself
+    std::istream* m_stream{nullptr};
+    std::unique_ptr<char[]> m_buffer;
+    size_t m_capacity{0};
+    bool m_eof{false};
+
+    // unread part of the mapping or buffer
+    const char* m_pos{nullptr};
+    const char* m_end{nullptr};
+
+    bool mapFile(const std::string& path);
+    void initStream(std::istream& is);
+    // Move the unread data to the front of the buffer and read more after it
+    /// @return false if nothing more could be read
+    bool refill();
+};
+
+}  // namespace aoc
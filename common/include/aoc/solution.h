@@ -0,0 +1,130 @@
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <string>
+
+#include "aoc/line_reader.h"
+#include "aoc/thread_pool.h"
+#include "aoc/trace.h"
+
+namespace aoc {
+
+using Clock = std::chrono::steady_clock;
+
+struct PhaseTimes {
+    Clock::duration parse{};
+    Clock::duration solve{};
+    Clock::duration part1{};
+    Clock::duration part2{};
+};
+
+// One day's puzzle solution, split into phases which can be run and timed separately.
+// parse() reads the puzzle input once, both parts then only read the parsed input.
+// Work which both parts need but which is not input parsing may go into an optional solve step,
+// which maps the parsed input to the one the parts read and is run and timed as its own phase.
+// A part may take a ThreadPool as third parameter to split its work on; other parts run on the
+// calling thread only.
+class Solution {
+   public:
+    // Type-erased result of parse()
+    using ParsedInput = std::shared_ptr<const void>;
+
+    template <typename Input, typename Part1, typename Part2>
+    Solution(std::string name, std::string input_file, std::string source_dir,
+             Input (*parse)(LineReader&), Part1 part1, Part2 part2)
+        : m_name{std::move(name)},
+          m_input_file{std::move(input_file)},
+          m_source_dir{std::move(source_dir)},
+          m_parse{[parse](LineReader& in) -> ParsedInput {
+              return std::make_shared<const Input>(parse(in));
+          }},
+          m_part1{erasePart<Input>(part1)},
+          m_part2{erasePart<Input>(part2)} {}
+
+    template <typename Input, typename Solved, typename Part1, typename Part2>
+    Solution(std::string name, std::string input_file, std::string source_dir,
+             Input (*parse)(LineReader&), Solved (*solve)(const Input&), Part1 part1, Part2 part2)
+        : m_name{std::move(name)},
+          m_input_file{std::move(input_file)},
+          m_source_dir{std::move(source_dir)},
+          m_parse{[parse](LineReader& in) -> ParsedInput {
+              return std::make_shared<const Input>(parse(in));
+          }},
+          m_solve{[solve](const ParsedInput& input) -> ParsedInput {
+              return std::make_shared<const Solved>(solve(*static_cast<const Input*>(input.get())));
+          }},
+          m_part1{erasePart<Solved>(part1)},
+          m_part2{erasePart<Solved>(part2)} {}
+
+    const std::string& name() const { return m_name; }
+    // name of the puzzle input file inside the day's directory
+    const std::string& inputFile() const { return m_input_file; }
+    // directory of the day's sources (and input files)
+    const std::string& sourceDir() const { return m_source_dir; }
+
+    ParsedInput parse(LineReader& in) const {
+        AOC_TRACE_SCOPE(m_name + " parse");
+        return m_parse(in);
+    }
+    bool hasSolve() const { return static_cast<bool>(m_solve); }
+    // Input of the parts: the result of the solve step, or the parsed input if there is none
+    ParsedInput solve(const ParsedInput& input) const {
+        if (!m_solve) return input;
+        AOC_TRACE_SCOPE(m_name + " solve");
+        return m_solve(input);
+    }
+    void part1(const ParsedInput& input, std::ostream& os, ThreadPool& pool) const {
+        AOC_TRACE_SCOPE(m_name + " part1");
+        m_part1(input, os, pool);
+    }
+    void part2(const ParsedInput& input, std::ostream& os, ThreadPool& pool) const {
+        AOC_TRACE_SCOPE(m_name + " part2");
+        m_part2(input, os, pool);
+    }
+
+    // Parse the input, run the solve step and both parts, writing the answers to os
+    PhaseTimes run(LineReader& in, std::ostream& os, ThreadPool& pool) const;
+
+   private:
+    using Part = std::function<void(const ParsedInput&, std::ostream&, ThreadPool&)>;
+
+    std::string m_name;
+    std::string m_input_file;
+    std::string m_source_dir;
+
+    std::function<ParsedInput(LineReader&)> m_parse;
+    std::function<ParsedInput(const ParsedInput&)> m_solve;  // empty if there is no solve step
+    Part m_part1;
+    Part m_part2;
+
+    template <typename Input>
+    static Part erasePart(void (*part)(const Input&, std::ostream&)) {
+        return [part](const ParsedInput& input, std::ostream& os, ThreadPool&) {
+            part(*static_cast<const Input*>(input.get()), os);
+        };
+    }
+    template <typename Input>
+    static Part erasePart(void (*part)(const Input&, std::ostream&, ThreadPool&)) {
+        return [part](const ParsedInput& input, std::ostream& os, ThreadPool& pool) {
+            part(*static_cast<const Input*>(input.get()), os, pool);
+        };
+    }
+};
+
+// If path is set, write the recorded trace there and print its summary to stderr
+void writeTrace(const std::optional<std::string>& path);
+
+// Command line entry point of each day: dayNN [INPUT|-] [-j THREADS] [--repeat N] [--trace FILE]
+// Solves the given input (default: the day's input file in the working directory, "-" for stdin)
+// and prints the answers. Parts which take a pool get one with THREADS threads including the
+// calling one (default: one per hardware thread). With --repeat, the solve step and both parts are
+// then run N more times on the already parsed input, and min/median/max timings of each phase are
+// printed to stderr.
+// --trace writes a Chrome trace of aoc/trace.h timers and counters (only with AOC_TRACE builds).
+int runStandalone(const Solution& solution, int argc, char* argv[]);
+
+}  // namespace aoc
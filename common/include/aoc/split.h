@@ -0,0 +1,128 @@
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace aoc {
+
+// Python-like string split which yields views into the split string instead of copies.
+// The split string must outlive the view and its iterators.
+// Like Python, splitting always yields at least one (possibly empty) token.
+class SplitView {
+   public:
+    class iterator {
+       public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const std::string_view*;
+        using reference = std::string_view;
+
+        iterator() = default;
+
+        std::string_view operator*() const { return m_s.substr(m_start, m_end - m_start); }
+
+        iterator& operator++();
+        iterator operator++(int) {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        bool operator==(const iterator& rhs) const { return m_start == rhs.m_start; }
+        bool operator!=(const iterator& rhs) const { return !(*this == rhs); }
+
+       private:
+        friend class SplitView;
+        iterator(std::string_view s, std::string_view delimiter, size_t start);
+
+        std::string_view m_s;
+        std::string_view m_delimiter;
+        size_t m_start{std::string_view::npos};  // start of current token, npos at end
+        size_t m_end{std::string_view::npos};    // end of current token
+    };
+
+    SplitView(std::string_view s, std::string_view delimiter);
+
+    iterator begin() const { return iterator(m_s, m_delimiter, 0); }
+    iterator end() const { return iterator(); }
+
+   private:
+    std::string_view m_s;
+    std::string_view m_delimiter;
+};
+
+inline SplitView split(std::string_view s, std::string_view delimiter) {
+    return SplitView(s, delimiter);
+}
+
+// Split into exactly N tokens, e.g. split_n<2>("a -> b", " -> ")
+/// @throws std::invalid_argument if the number of tokens is not N
+template <size_t N>
+std::array<std::string_view, N> split_n(std::string_view s, std::string_view delimiter) {
+    const SplitView view = split(s, delimiter);
+    std::array<std::string_view, N> tokens{};
+    size_t count = 0;
+    auto it = view.begin();
+    for (; it != view.end() && count < N; ++it) {
+        tokens[count++] = *it;
+    }
+    if (count != N || it != view.end()) {
+        throw std::invalid_argument("Expected " + std::to_string(N) + " tokens in '" +
+                                    std::string(s) + "'");
+    }
+    return tokens;
+}
+
+// View without leading and trailing whitespace, like Python's str.strip()
+inline std::string_view trim(std::string_view s) {
+    constexpr std::string_view WHITESPACE = " \t\r\n\f\v";
+    const size_t first = s.find_first_not_of(WHITESPACE);
+    if (first == std::string_view::npos) return {};
+    return s.substr(first, s.find_last_not_of(WHITESPACE) - first + 1);
+}
+
+// Convert whole string to number without locale handling or allocations
+/// @throws std::invalid_argument if sv is not exactly one number
+template <typename T>
+T to_number(std::string_view sv) {
+    T value{};
+    const char* const last = sv.data() + sv.size();
+    const auto [ptr, ec] = std::from_chars(sv.data(), last, value);
+    if (ec != std::errc{} || ptr != last) {
+        throw std::invalid_argument("Not a number: '" + std::string(sv) + "'");
+    }
+    return value;
+}
+
+// Reads delimited fields from a string one after the other, e.g. for "x=20..30, y=-10..-5"
+class FieldReader {
+   public:
+    explicit FieldReader(std::string_view s) : m_rest{s} {}
+
+    // Skip everything up to and including the next delimiter
+    /// @throws std::invalid_argument if delimiter is not found
+    FieldReader& skip(std::string_view delimiter);
+
+    // Field up to the next delimiter (which is consumed) or the rest if there is none
+    std::string_view next(std::string_view delimiter);
+
+    template <typename T>
+    T next_number(std::string_view delimiter) {
+        return to_number<T>(next(delimiter));
+    }
+
+    std::string_view rest() const { return m_rest; }
+    bool empty() const { return m_rest.empty(); }
+
+   private:
+    std::string_view m_rest;
+};
+
+}  // namespace aoc
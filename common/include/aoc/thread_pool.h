@@ -0,0 +1,106 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace aoc {
+
+// Work-stealing thread pool.
+// Every worker has its own task queue: it runs its newest task first and, when its queue is empty,
+// steals the oldest task of another queue. Tasks submitted from outside the pool go to a shared
+// queue which the workers steal from as well.
+class ThreadPool {
+   public:
+    using Task = std::function<void()>;
+
+    // A pool with 0 workers is valid: tasks then only run in TaskGroup::wait() of the caller
+    explicit ThreadPool(size_t num_workers);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t numWorkers() const { return m_threads.size(); }
+
+    // Index of the worker of this pool running the calling thread,
+    // or numWorkers() if it is called from outside of the pool
+    size_t currentWorker() const;
+
+    void submit(Task task);
+
+    // Run one pending task on the calling thread
+    /// @return false if there was no task to run
+    bool runPendingTask();
+
+   private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> m_queues;  // one per worker, then the shared queue
+    std::vector<std::thread> m_threads;
+
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake;
+    std::atomic<size_t> m_pending{0};  // number of submitted tasks which were not yet taken
+    bool m_stop{false};
+
+    void workerLoop(size_t worker);
+    // take newest task of own queue, else oldest task of any other queue
+    std::optional<Task> takeTask(size_t own_queue);
+};
+
+// Set of tasks on a pool which can be waited for.
+// Waiting threads run pending tasks of the pool meanwhile, so tasks may wait for nested groups
+// without blocking a worker.
+class TaskGroup {
+   public:
+    explicit TaskGroup(ThreadPool& pool) : m_pool{pool} {}
+    ~TaskGroup();
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+
+    void run(std::function<void()> task);
+
+    // Wait for all tasks of this group, then rethrow the first exception thrown by one of them
+    void wait();
+
+   private:
+    ThreadPool& m_pool;
+    std::atomic<size_t> m_outstanding{0};
+    std::mutex m_error_mutex;
+    std::exception_ptr m_error;
+};
+
+// [0, size) split into a few chunks per thread of a pool, so threads which finish early can take
+// the rest, for data-parallel loops on a TaskGroup
+struct Chunks {
+    size_t size;
+    size_t count;  // at least 1, even if size is 0
+    size_t chunk_size;
+
+    size_t begin(const size_t chunk) const { return std::min(size, chunk * chunk_size); }
+    size_t end(const size_t chunk) const { return std::min(size, (chunk + 1) * chunk_size); }
+};
+
+// Chunks of at least min_chunk elements, unless size is smaller
+inline Chunks chunks(const size_t size, const ThreadPool& pool, const size_t min_chunk) {
+    const size_t num_threads = pool.numWorkers() + 1;  // the calling thread helps while waiting
+    const size_t count = std::clamp<size_t>(size / min_chunk, 1, num_threads * 4);
+    return Chunks{.size = size, .count = count, .chunk_size = (size + count - 1) / count};
+}
+
+}  // namespace aoc
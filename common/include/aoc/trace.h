@@ -0,0 +1,78 @@
+#pragma once
+
+// Lightweight scoped timers and counters which are written as a Chrome trace (chrome://tracing,
+// https://ui.perfetto.dev) and summarized in one line.
+// Only built with the AOC_TRACE CMake option; otherwise the macros expand to nothing and their
+// arguments are not evaluated.
+//
+//   AOC_TRACE_SCOPE("best_match");         // time until the end of the enclosing scope
+//   AOC_TRACE_COUNT("dijkstra pops", 1);   // add to a counter
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace aoc::trace {
+
+#ifdef AOC_TRACE
+constexpr bool ENABLED = true;
+#else
+constexpr bool ENABLED = false;
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+// Records the time from construction to destruction as one trace event of the calling thread
+class Scope {
+   public:
+    explicit Scope(std::string name);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    std::string m_name;
+    Clock::time_point m_start;
+};
+
+// Counter shared by all threads. Registers itself, so it must live until the trace is written.
+class Counter {
+   public:
+    explicit Counter(std::string name);
+
+    void add(const int64_t n) { m_value.fetch_add(n, std::memory_order_relaxed); }
+
+    const std::string& name() const { return m_name; }
+    int64_t value() const { return m_value.load(std::memory_order_relaxed); }
+
+   private:
+    std::string m_name;
+    std::atomic<int64_t> m_value{0};
+};
+
+// Write all events recorded so far as Chrome trace-event JSON.
+// No traced code may run concurrently.
+void writeChromeTrace(const std::string& path);
+
+// One line with the event count, the scopes which took the most time and all counters
+std::string summary();
+
+}  // namespace aoc::trace
+
+#define AOC_TRACE_CONCAT_IMPL(a, b) a##b
+#define AOC_TRACE_CONCAT(a, b) AOC_TRACE_CONCAT_IMPL(a, b)
+
+#ifdef AOC_TRACE
+#define AOC_TRACE_SCOPE(name) \
+    const ::aoc::trace::Scope AOC_TRACE_CONCAT(aoc_trace_scope_, __LINE__)(name)
+#define AOC_TRACE_COUNT(name, n)                                  \
+    do {                                                          \
+        static ::aoc::trace::Counter aoc_trace_counter_{(name)}; \
+        aoc_trace_counter_.add(n);                                \
+    } while (false)
+#else
+#define AOC_TRACE_SCOPE(name) static_cast<void>(0)
+#define AOC_TRACE_COUNT(name, n) static_cast<void>(0)
+#endif
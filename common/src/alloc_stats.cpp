@@ -0,0 +1,118 @@
+// Replacements of the global operator new/delete which count allocations per thread.
+// Only compiled with the AOC_ALLOC_STATS CMake option.
+#include "aoc/alloc_stats.h"
+
+#include <malloc.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace aoc {
+
+namespace {
+
+struct ThreadCounters {
+    uint64_t count;
+    uint64_t bytes;
+    int64_t live;  // may become negative when memory of other threads is freed
+    int64_t peak;
+};
+
+// trivially initialized, so it can be used by allocations during thread and program startup
+thread_local ThreadCounters t_counters;
+
+void* allocate(const size_t size, const size_t alignment) noexcept {
+    void* p = nullptr;
+    if (alignment > alignof(std::max_align_t)) {
+        // aligned_alloc requires a multiple of the alignment
+        p = std::aligned_alloc(alignment, (std::max<size_t>(size, 1) + alignment - 1) /
+                                              alignment * alignment);
+    } else {
+        p = std::malloc(std::max<size_t>(size, 1));
+    }
+    if (p == nullptr) return nullptr;
+
+    ThreadCounters& counters = t_counters;
+    ++counters.count;
+    counters.bytes += size;
+    counters.live += static_cast<int64_t>(malloc_usable_size(p));
+    counters.peak = std::max(counters.peak, counters.live);
+    return p;
+}
+
+void deallocate(void* p) noexcept {
+    if (p == nullptr) return;
+    t_counters.live -= static_cast<int64_t>(malloc_usable_size(p));
+    std::free(p);
+}
+
+void* allocateOrThrow(const size_t size, const size_t alignment) {
+    void* p = allocate(size, alignment);
+    if (p == nullptr) throw std::bad_alloc();
+    return p;
+}
+
+}  // namespace
+
+AllocScope::AllocScope()
+    : m_start_count{t_counters.count},
+      m_start_bytes{t_counters.bytes},
+      m_start_live{t_counters.live},
+      m_outer_peak{t_counters.peak} {
+    t_counters.peak = t_counters.live;
+}
+
+AllocScope::~AllocScope() { t_counters.peak = std::max(t_counters.peak, m_outer_peak); }
+
+AllocStats AllocScope::stats() const {
+    return AllocStats{.count = t_counters.count - m_start_count,
+                      .bytes = t_counters.bytes - m_start_bytes,
+                      .peak_live = static_cast<uint64_t>(
+                          std::max<int64_t>(0, t_counters.peak - m_start_live))};
+}
+
+}  // namespace aoc
+
+constexpr size_t DEFAULT_ALIGNMENT = alignof(std::max_align_t);
+
+void* operator new(const size_t size) { return aoc::allocateOrThrow(size, DEFAULT_ALIGNMENT); }
+void* operator new[](const size_t size) { return aoc::allocateOrThrow(size, DEFAULT_ALIGNMENT); }
+void* operator new(const size_t size, const std::align_val_t alignment) {
+    return aoc::allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new[](const size_t size, const std::align_val_t alignment) {
+    return aoc::allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+void* operator new(const size_t size, const std::nothrow_t&) noexcept {
+    return aoc::allocate(size, DEFAULT_ALIGNMENT);
+}
+void* operator new[](const size_t size, const std::nothrow_t&) noexcept {
+    return aoc::allocate(size, DEFAULT_ALIGNMENT);
+}
+void* operator new(const size_t size, const std::align_val_t alignment,
+                   const std::nothrow_t&) noexcept {
+    return aoc::allocate(size, static_cast<size_t>(alignment));
+}
+void* operator new[](const size_t size, const std::align_val_t alignment,
+                     const std::nothrow_t&) noexcept {
+    return aoc::allocate(size, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept { aoc::deallocate(p); }
+void operator delete[](void* p) noexcept { aoc::deallocate(p); }
+void operator delete(void* p, size_t) noexcept { aoc::deallocate(p); }
+void operator delete[](void* p, size_t) noexcept { aoc::deallocate(p); }
+void operator delete(void* p, std::align_val_t) noexcept { aoc::deallocate(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { aoc::deallocate(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { aoc::deallocate(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { aoc::deallocate(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { aoc::deallocate(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { aoc::deallocate(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    aoc::deallocate(p);
+}
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept {
+    aoc::deallocate(p);
+}
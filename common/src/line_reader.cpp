@@ -0,0 +1,112 @@
+#include "aoc/line_reader.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace aoc {
+
+namespace {
+
+constexpr size_t INITIAL_BUFFER_SIZE = 64 * 1024;
+
+}  // namespace
+
+LineReader::LineReader(const std::string& path) {
+    if (path == "-") {
+        initStream(std::cin);
+        return;
+    }
+    if (mapFile(path)) return;
+
+    m_owned_stream = std::make_unique<std::ifstream>(path, std::ios::binary);
+    if (!*m_owned_stream) throw std::runtime_error("Cannot open " + path);
+    initStream(*m_owned_stream);
+}
+
+LineReader::LineReader(std::istream& is) { initStream(is); }
+
+LineReader::~LineReader() {
+    if (m_map != nullptr) munmap(m_map, m_map_size);
+}
+
+bool LineReader::mapFile(const std::string& path) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0) {
+        // pipes etc. can't be mapped, and mapping an empty file fails
+        ::close(fd);
+        return false;
+    }
+
+    void* map = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping stays valid
+    if (map == MAP_FAILED) return false;
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+
+    m_map = map;
+    m_map_size = st.st_size;
+    m_pos = static_cast<const char*>(m_map);
+    m_end = m_pos + m_map_size;
+    return true;
+}
+
+void LineReader::initStream(std::istream& is) {
+    m_stream = &is;
+    m_capacity = INITIAL_BUFFER_SIZE;
+    m_buffer = std::make_unique<char[]>(m_capacity);
+    m_pos = m_buffer.get();
+    m_end = m_pos;
+}
+
+bool LineReader::getline(std::string_view& line) {
+    while (true) {
+        const size_t available = m_end - m_pos;
+        if (const void* newline = std::memchr(m_pos, '\n', available)) {
+            const char* line_end = static_cast<const char*>(newline);
+            line = std::string_view(m_pos, line_end - m_pos);
+            m_pos = line_end + 1;
+            return true;
+        }
+        if (isMapped() || !refill()) {
+            // last line without '\n'
+            if (m_pos == m_end) return false;
+            line = std::string_view(m_pos, m_end - m_pos);
+            m_pos = m_end;
+            return true;
+        }
+    }
+}
+
+bool LineReader::refill() {
+    if (m_eof) return false;
+
+    const size_t unread = m_end - m_pos;
+    if (unread == m_capacity) {
+        // a line longer than the buffer
+        m_capacity *= 2;
+        auto bigger = std::make_unique<char[]>(m_capacity);
+        std::memcpy(bigger.get(), m_pos, unread);
+        m_buffer = std::move(bigger);
+    } else {
+        std::memmove(m_buffer.get(), m_pos, unread);
+    }
+    char* const buffer = m_buffer.get();
+    m_pos = buffer;
+    m_end = buffer + unread;
+
+    m_stream->read(buffer + unread, m_capacity - unread);
+    const auto read = m_stream->gcount();
+    if (read < static_cast<std::streamsize>(m_capacity - unread)) m_eof = true;
+    m_end += read;
+    return read > 0;
+}
+
+}  // namespace aoc
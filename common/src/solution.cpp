@@ -0,0 +1,194 @@
+#include "aoc/solution.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <streambuf>
+#include <thread>
+#include <vector>
+
+#include "aoc/alloc_stats.h"
+#include "aoc/split.h"
+
+namespace aoc {
+
+namespace {
+
+// Stream buffer which discards everything, for repeated runs whose output is not needed
+class NullBuffer : public std::streambuf {
+   protected:
+    int overflow(const int c) override { return c; }
+    std::streamsize xsputn(const char*, const std::streamsize n) override { return n; }
+};
+
+double toMs(const Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); }
+
+void printStats(const char* phase, std::vector<Clock::duration> times) {
+    std::sort(times.begin(), times.end());
+    std::cerr << phase << ": min " << toMs(times.front()) << " ms, median "
+              << toMs(times[times.size() / 2]) << " ms, max " << toMs(times.back()) << " ms ("
+              << times.size() << " runs)\n";
+}
+
+template <typename F>
+AllocStats counted(F&& f) {
+    const AllocScope scope;
+    f();
+    return scope.stats();
+}
+
+void printAllocStats(const char* phase, const AllocStats& stats) {
+    std::cerr << phase << " allocations: " << stats.count << ", " << stats.bytes
+              << " bytes, peak live " << stats.peak_live << " bytes\n";
+}
+
+template <typename F>
+Clock::duration timed(F&& f) {
+    const auto start = Clock::now();
+    f();
+    return Clock::now() - start;
+}
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " [INPUT|-] [-j THREADS] [--repeat N] [--trace FILE]\n";
+}
+
+}  // namespace
+
+void writeTrace(const std::optional<std::string>& path) {
+    if (!path) return;
+    trace::writeChromeTrace(*path);
+    std::cerr << trace::summary() << "\n";
+}
+
+PhaseTimes Solution::run(LineReader& in, std::ostream& os, ThreadPool& pool) const {
+    PhaseTimes times;
+
+    auto start = Clock::now();
+    const ParsedInput parsed = parse(in);
+    times.parse = Clock::now() - start;
+
+    start = Clock::now();
+    const ParsedInput input = solve(parsed);
+    times.solve = Clock::now() - start;
+
+    start = Clock::now();
+    part1(input, os, pool);
+    times.part1 = Clock::now() - start;
+
+    start = Clock::now();
+    part2(input, os, pool);
+    times.part2 = Clock::now() - start;
+
+    return times;
+}
+
+namespace {
+
+// Parse and solve the input once, then repeat the solve step and the parts as requested
+int runPhases(const Solution& solution, LineReader& in, ThreadPool& pool, const int repeat,
+              const std::optional<std::string>& trace_path) {
+    if (repeat == 0 && !ALLOC_STATS_ENABLED) {
+        solution.run(in, std::cout, pool);
+        writeTrace(trace_path);
+        return 0;
+    }
+
+    Solution::ParsedInput parsed;
+    Clock::duration parse_time{};
+    const AllocStats parse_allocs =
+        counted([&]() { parse_time = timed([&]() { parsed = solution.parse(in); }); });
+    Solution::ParsedInput input;
+    const AllocStats solve_allocs = counted([&]() { input = solution.solve(parsed); });
+    const AllocStats part1_allocs = counted([&]() { solution.part1(input, std::cout, pool); });
+    const AllocStats part2_allocs = counted([&]() { solution.part2(input, std::cout, pool); });
+    if (ALLOC_STATS_ENABLED) {
+        printAllocStats("parse", parse_allocs);
+        if (solution.hasSolve()) printAllocStats("solve", solve_allocs);
+        printAllocStats("part1", part1_allocs);
+        printAllocStats("part2", part2_allocs);
+    }
+    if (repeat == 0) {
+        writeTrace(trace_path);
+        return 0;
+    }
+
+    NullBuffer null_buffer;
+    std::ostream null_stream(&null_buffer);
+    std::vector<Clock::duration> solve_times;
+    std::vector<Clock::duration> part1_times;
+    std::vector<Clock::duration> part2_times;
+    for (int i = 0; i < repeat; ++i) {
+        if (solution.hasSolve()) {
+            solve_times.push_back(timed([&]() { input = solution.solve(parsed); }));
+        }
+        part1_times.push_back(timed([&]() { solution.part1(input, null_stream, pool); }));
+        part2_times.push_back(timed([&]() { solution.part2(input, null_stream, pool); }));
+    }
+
+    std::cerr << std::fixed << std::setprecision(3);
+    std::cerr << "parse: " << toMs(parse_time) << " ms (1 run)\n";
+    if (solution.hasSolve()) printStats("solve", std::move(solve_times));
+    printStats("part1", std::move(part1_times));
+    printStats("part2", std::move(part2_times));
+    writeTrace(trace_path);
+    return 0;
+}
+
+}  // namespace
+
+int runStandalone(const Solution& solution, const int argc, char* argv[]) {
+    std::optional<std::string> input_path;
+    std::optional<std::string> trace_path;
+    int repeat = 0;
+    int num_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if ((arg == "--repeat" || arg == "-j") && i + 1 < argc) {
+            int& value = arg == "-j" ? num_threads : repeat;
+            try {
+                value = to_number<int>(argv[++i]);
+            } catch (const std::invalid_argument& e) {
+                std::cerr << e.what() << "\n";
+                usage(argv[0]);
+                return 1;
+            }
+            if (value < 1) {
+                usage(argv[0]);
+                return 1;
+            }
+        } else if (arg == "--trace" && i + 1 < argc) {
+            trace_path = argv[++i];
+            if (!trace::ENABLED) {
+                std::cerr << "Tracing is not built in, configure with -DAOC_TRACE=ON\n";
+                return 1;
+            }
+        } else if ((arg == "-" || !arg.starts_with("-")) && !input_path) {
+            input_path = arg;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    std::optional<LineReader> opened;
+    try {
+        opened.emplace(input_path.value_or(solution.inputFile()));
+    } catch (const std::runtime_error& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    // the calling thread runs tasks while waiting, so it counts as one of the threads
+    ThreadPool pool(static_cast<size_t>(num_threads - 1));
+
+    try {
+        return runPhases(solution, *opened, pool, repeat, trace_path);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+}
+
+}  // namespace aoc
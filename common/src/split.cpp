@@ -0,0 +1,48 @@
+#include "aoc/split.h"
+
+namespace aoc {
+
+SplitView::SplitView(std::string_view s, std::string_view delimiter)
+    : m_s{s}, m_delimiter{delimiter} {
+    if (m_delimiter.empty()) throw std::invalid_argument("Cannot split on empty delimiter");
+}
+
+SplitView::iterator::iterator(std::string_view s, std::string_view delimiter, size_t start)
+    : m_s{s}, m_delimiter{delimiter}, m_start{start} {
+    m_end = m_s.find(m_delimiter, m_start);
+}
+
+SplitView::iterator& SplitView::iterator::operator++() {
+    if (m_end == std::string_view::npos) {
+        // that was the last token
+        m_start = std::string_view::npos;
+        return *this;
+    }
+    m_start = m_end + m_delimiter.size();
+    m_end = m_s.find(m_delimiter, m_start);
+    return *this;
+}
+
+FieldReader& FieldReader::skip(std::string_view delimiter) {
+    const size_t pos = m_rest.find(delimiter);
+    if (pos == std::string_view::npos) {
+        throw std::invalid_argument("Delimiter '" + std::string(delimiter) + "' not found in '" +
+                                    std::string(m_rest) + "'");
+    }
+    m_rest.remove_prefix(pos + delimiter.size());
+    return *this;
+}
+
+std::string_view FieldReader::next(std::string_view delimiter) {
+    const size_t pos = m_rest.find(delimiter);
+    if (pos == std::string_view::npos) {
+        const std::string_view field = m_rest;
+        m_rest = {};
+        return field;
+    }
+    const std::string_view field = m_rest.substr(0, pos);
+    m_rest.remove_prefix(pos + delimiter.size());
+    return field;
+}
+
+}  // namespace aoc
@@ -0,0 +1,131 @@
+#include "aoc/thread_pool.h"
+
+namespace aoc {
+
+namespace {
+
+// pool and worker index of the calling thread, if it is a worker
+thread_local const ThreadPool* t_pool = nullptr;
+thread_local size_t t_worker = 0;
+
+}  // namespace
+
+ThreadPool::ThreadPool(const size_t num_workers) {
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        m_queues.emplace_back(std::make_unique<Queue>());
+    }
+    m_threads.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        m_threads.emplace_back([this, i]() { workerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard lock(m_wake_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+size_t ThreadPool::currentWorker() const { return t_pool == this ? t_worker : numWorkers(); }
+
+void ThreadPool::submit(Task task) {
+    Queue& queue = *m_queues[currentWorker()];
+    {
+        std::lock_guard lock(queue.mutex);
+        queue.tasks.emplace_back(std::move(task));
+    }
+    {
+        std::lock_guard lock(m_wake_mutex);
+        ++m_pending;
+    }
+    m_wake.notify_one();
+}
+
+bool ThreadPool::runPendingTask() {
+    std::optional<Task> task = takeTask(currentWorker());
+    if (!task) return false;
+    (*task)();
+    return true;
+}
+
+void ThreadPool::workerLoop(const size_t worker) {
+    t_pool = this;
+    t_worker = worker;
+
+    while (true) {
+        if (std::optional<Task> task = takeTask(worker)) {
+            (*task)();
+            continue;
+        }
+
+        std::unique_lock lock(m_wake_mutex);
+        m_wake.wait(lock, [this]() { return m_stop || m_pending > 0; });
+        if (m_stop) return;
+    }
+}
+
+std::optional<ThreadPool::Task> ThreadPool::takeTask(const size_t own_queue) {
+    if (m_pending == 0) return std::nullopt;
+
+    {
+        Queue& queue = *m_queues[own_queue];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            Task task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            --m_pending;
+            return task;
+        }
+    }
+
+    for (size_t offset = 1; offset < m_queues.size(); ++offset) {
+        Queue& queue = *m_queues[(own_queue + offset) % m_queues.size()];
+        std::lock_guard lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            Task task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            --m_pending;
+            return task;
+        }
+    }
+    return std::nullopt;
+}
+
+TaskGroup::~TaskGroup() {
+    // tasks reference this group, so they must have finished - errors can't be reported here
+    while (m_outstanding > 0) {
+        if (!m_pool.runPendingTask()) std::this_thread::yield();
+    }
+}
+
+void TaskGroup::run(std::function<void()> task) {
+    ++m_outstanding;
+    m_pool.submit([this, task = std::move(task)]() {
+        try {
+            task();
+        } catch (...) {
+            std::lock_guard lock(m_error_mutex);
+            if (!m_error) m_error = std::current_exception();
+        }
+        --m_outstanding;
+    });
+}
+
+void TaskGroup::wait() {
+    while (m_outstanding > 0) {
+        if (!m_pool.runPendingTask()) std::this_thread::yield();
+    }
+
+    std::lock_guard lock(m_error_mutex);
+    if (m_error) {
+        std::exception_ptr error = std::exchange(m_error, nullptr);
+        std::rethrow_exception(error);
+    }
+}
+
+}  // namespace aoc
@@ -0,0 +1,154 @@
+#include "aoc/trace.h"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace aoc::trace {
+
+namespace {
+
+struct Event {
+    std::string name;
+    Clock::time_point start;
+    Clock::duration duration;
+};
+
+// Events of one thread. Only the owning thread appends, so no lock is needed while tracing.
+struct ThreadEvents {
+    int tid;
+    std::vector<Event> events;
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<ThreadEvents>> threads;  // kept after their threads exit
+    std::vector<const Counter*> counters;
+    const Clock::time_point start = Clock::now();
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+ThreadEvents& threadEvents() {
+    thread_local const std::shared_ptr<ThreadEvents> events = []() {
+        Registry& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        auto created = std::make_shared<ThreadEvents>();
+        created->tid = static_cast<int>(reg.threads.size());
+        reg.threads.push_back(created);
+        return created;
+    }();
+    return *events;
+}
+
+std::string escapeJson(const std::string& s) {
+    std::string escaped;
+    for (const char c : s) {
+        if (c == '"' || c == '\\') escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+double toUs(const Clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+}  // namespace
+
+Scope::Scope(std::string name) : m_name{std::move(name)} {
+    // the registry holds the epoch of all timestamps, so it must exist before the first start
+    registry();
+    m_start = Clock::now();
+}
+
+Scope::~Scope() {
+    const auto end = Clock::now();
+    threadEvents().events.push_back(Event{std::move(m_name), m_start, end - m_start});
+}
+
+Counter::Counter(std::string name) : m_name{std::move(name)} {
+    Registry& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    reg.counters.push_back(this);
+}
+
+void writeChromeTrace(const std::string& path) {
+    Registry& reg = registry();
+    std::lock_guard lock(reg.mutex);
+
+    std::ofstream ofs(path);
+    if (!ofs) throw std::runtime_error("Cannot open " + path);
+
+    ofs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    auto separator = [&first]() -> const char* { return std::exchange(first, false) ? "" : ",\n"; };
+
+    Clock::time_point last_end = reg.start;
+    for (const auto& thread : reg.threads) {
+        for (const Event& event : thread->events) {
+            ofs << separator() << "{\"name\":\"" << escapeJson(event.name)
+                << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << thread->tid
+                << ",\"ts\":" << toUs(event.start - reg.start) << ",\"dur\":" << toUs(event.duration)
+                << "}";
+            last_end = std::max(last_end, event.start + event.duration);
+        }
+    }
+    // counters are only known as totals, so show them once at the end
+    for (const Counter* counter : reg.counters) {
+        ofs << separator() << "{\"name\":\"" << escapeJson(counter->name())
+            << "\",\"ph\":\"C\",\"pid\":1,\"ts\":" << toUs(last_end - reg.start)
+            << ",\"args\":{\"value\":" << counter->value() << "}}";
+    }
+    ofs << "\n]}\n";
+}
+
+std::string summary() {
+    Registry& reg = registry();
+    std::lock_guard lock(reg.mutex);
+
+    struct ScopeTotal {
+        Clock::duration duration{};
+        size_t count{0};
+    };
+    std::map<std::string, ScopeTotal> totals;
+    size_t num_events = 0;
+    for (const auto& thread : reg.threads) {
+        num_events += thread->events.size();
+        for (const Event& event : thread->events) {
+            ScopeTotal& total = totals[event.name];
+            total.duration += event.duration;
+            ++total.count;
+        }
+    }
+
+    std::vector<std::pair<std::string, ScopeTotal>> slowest(totals.begin(), totals.end());
+    std::sort(slowest.begin(), slowest.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.duration > rhs.second.duration;
+    });
+    slowest.resize(std::min<size_t>(slowest.size(), 5));
+
+    std::ostringstream ss;
+    ss.setf(std::ios::fixed);
+    ss.precision(3);
+    ss << "trace: " << num_events << " events on " << reg.threads.size() << " thread(s); top:";
+    for (const auto& [name, total] : slowest) {
+        ss << " " << name << " " << toUs(total.duration) / 1000 << " ms (" << total.count << "x)";
+    }
+    ss << "; counters:";
+    for (const Counter* counter : reg.counters) {
+        ss << " " << counter->name() << "=" << counter->value();
+    }
+    return ss.str();
+}
+
+}  // namespace aoc::trace
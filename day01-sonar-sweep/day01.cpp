@@ -0,0 +1,373 @@
+#include "day01.h"
+
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DAY01_X86
+#include <immintrin.h>
+#endif
+
+namespace day01 {
+
+namespace
+{
+
+// Comparing the sums of two consecutive windows reduces to comparing the value which enters the
+// window with the one which leaves it: values[i] > values[i - window_size].
+// Each kernel counts this for i in [begin, end), where begin >= window_size.
+int64_t countIncreasesScalar(const int *values, const size_t begin, const size_t end,
+                             const size_t window_size)
+{
+    int64_t increases = 0;
+    for (size_t i = begin; i < end; ++i)
+    {
+        increases += values[i] > values[i - window_size] ? 1 : 0;
+    }
+    return increases;
+}
+
+// The SIMD kernels count in 32-bit lanes, so each call may only cover MAX_SIMD_BLOCK values
+constexpr size_t MAX_SIMD_BLOCK = size_t{1} << 30;
+
+#ifdef DAY01_X86
+
+__attribute__((target("sse2"))) int64_t countIncreasesSse2(const int *values, const size_t begin,
+                                                           const size_t end,
+                                                           const size_t window_size)
+{
+    // each lane counts the increases of every 4th value; a comparison yields -1 for true.
+    // Two independent accumulators, so consecutive iterations don't wait for each other.
+    __m128i counts0 = _mm_setzero_si128();
+    __m128i counts1 = _mm_setzero_si128();
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const int *new_elems = values + i;
+        const int *old_elems = values + i - window_size;
+        counts0 = _mm_sub_epi32(
+            counts0,
+            _mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(new_elems)),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(old_elems))));
+        counts1 = _mm_sub_epi32(
+            counts1,
+            _mm_cmpgt_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(new_elems + 4)),
+                            _mm_loadu_si128(reinterpret_cast<const __m128i *>(old_elems + 4))));
+    }
+    const __m128i counts = _mm_add_epi32(counts0, counts1);
+
+    alignas(16) int lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), counts);
+    return int64_t{lanes[0]} + lanes[1] + lanes[2] + lanes[3] +
+           countIncreasesScalar(values, i, end, window_size);
+}
+
+__attribute__((target("avx2"))) int64_t countIncreasesAvx2(const int *values, const size_t begin,
+                                                           const size_t end,
+                                                           const size_t window_size)
+{
+    // like the SSE2 version with twice the lanes
+    __m256i counts0 = _mm256_setzero_si256();
+    __m256i counts1 = _mm256_setzero_si256();
+    size_t i = begin;
+    for (; i + 16 <= end; i += 16)
+    {
+        const int *new_elems = values + i;
+        const int *old_elems = values + i - window_size;
+        counts0 = _mm256_sub_epi32(
+            counts0, _mm256_cmpgt_epi32(
+                         _mm256_loadu_si256(reinterpret_cast<const __m256i *>(new_elems)),
+                         _mm256_loadu_si256(reinterpret_cast<const __m256i *>(old_elems))));
+        counts1 = _mm256_sub_epi32(
+            counts1, _mm256_cmpgt_epi32(
+                         _mm256_loadu_si256(reinterpret_cast<const __m256i *>(new_elems + 8)),
+                         _mm256_loadu_si256(reinterpret_cast<const __m256i *>(old_elems + 8))));
+    }
+
+    alignas(32) int lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), _mm256_add_epi32(counts0, counts1));
+    int64_t increases = 0;
+    for (const int lane : lanes)
+    {
+        increases += lane;
+    }
+    return increases + countIncreasesScalar(values, i, end, window_size);
+}
+
+#endif
+
+// Count for i in [begin, end) with the given instruction set
+int64_t countIncreasesRange(const int *values, const size_t begin, const size_t end,
+                            const size_t window_size, const Isa isa)
+{
+    int64_t increases = 0;
+    for (size_t block = begin; block < end; block += MAX_SIMD_BLOCK)
+    {
+        const size_t block_end = std::min(end, block + MAX_SIMD_BLOCK);
+        switch (isa)
+        {
+#ifdef DAY01_X86
+            case Isa::AVX2:
+                increases += countIncreasesAvx2(values, block, block_end, window_size);
+                break;
+            case Isa::SSE2:
+                increases += countIncreasesSse2(values, block, block_end, window_size);
+                break;
+#endif
+            default:
+                increases += countIncreasesScalar(values, block, block_end, window_size);
+        }
+    }
+    return increases;
+}
+
+Isa bestSupportedIsa()
+{
+    for (const Isa isa : {Isa::AVX2, Isa::SSE2})
+    {
+        if (isSupported(isa))
+        {
+            return isa;
+        }
+    }
+    return Isa::SCALAR;
+}
+
+}  // namespace
+
+const char *isaName(const Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::SCALAR:
+            return "scalar";
+        case Isa::SSE2:
+            return "sse2";
+        case Isa::AVX2:
+            return "avx2";
+    }
+    return "unknown";
+}
+
+bool isSupported(const Isa isa)
+{
+    switch (isa)
+    {
+        case Isa::SCALAR:
+            return true;
+#ifdef DAY01_X86
+        case Isa::SSE2:
+            return __builtin_cpu_supports("sse2");
+        case Isa::AVX2:
+            return __builtin_cpu_supports("avx2");
+#else
+        case Isa::SSE2:
+        case Isa::AVX2:
+            return false;
+#endif
+    }
+    return false;
+}
+
+int64_t countIncreases(const std::vector<int> &values, const int window_size, const Isa isa)
+{
+    assert(window_size >= 1);
+    assert(isSupported(isa));
+
+    const size_t window = static_cast<size_t>(window_size);
+    if (values.size() <= window)
+    {
+        return 0;
+    }
+    return countIncreasesRange(values.data(), window, values.size(), window, isa);
+}
+
+int64_t countIncreases(const std::vector<int> &values, const int window_size)
+{
+    static const Isa best_isa = bestSupportedIsa();
+    return countIncreases(values, window_size, best_isa);
+}
+
+int64_t countIncreases(const std::vector<int> &values, const int window_size,
+                       aoc::ThreadPool &pool)
+{
+    assert(window_size >= 1);
+    static const Isa best_isa = bestSupportedIsa();
+
+    const size_t window = static_cast<size_t>(window_size);
+    if (values.size() <= window)
+    {
+        return 0;
+    }
+
+    // Chunks of the compared values. Every chunk also reads the window_size values before it, so
+    // the chunks overlap and no comparison is lost.
+    constexpr size_t MIN_CHUNK = size_t{1} << 16;
+    const aoc::Chunks chunks = aoc::chunks(values.size() - window, pool, MIN_CHUNK);
+    if (chunks.count == 1)
+    {
+        // not worth a task, e.g. for the puzzle input
+        return countIncreasesRange(values.data(), window, values.size(), window, best_isa);
+    }
+
+    std::vector<int64_t> partial_increases(chunks.count, 0);
+    aoc::TaskGroup group(pool);
+    for (size_t chunk = 0; chunk < chunks.count; ++chunk)
+    {
+        group.run(
+            [&values, &partial_increases, &chunks, chunk, window]()
+            {
+                partial_increases[chunk] =
+                    countIncreasesRange(values.data(), window + chunks.begin(chunk),
+                                        window + chunks.end(chunk), window, best_isa);
+            });
+    }
+    group.wait();
+    return std::accumulate(partial_increases.begin(), partial_increases.end(), int64_t{0});
+}
+
+IncreaseCounter::IncreaseCounter(std::vector<int> window_sizes)
+    : m_window_sizes{std::move(window_sizes)}, m_increases(m_window_sizes.size(), 0)
+{
+    assert(!m_window_sizes.empty());
+    for (const int window_size : m_window_sizes)
+    {
+        if (window_size < 1)
+        {
+            throw std::invalid_argument("Window sizes must be positive");
+        }
+    }
+    m_ring.resize(*std::max_element(m_window_sizes.begin(), m_window_sizes.end()));
+}
+
+void IncreaseCounter::push(const int value)
+{
+    // the slot at m_pos holds the oldest value, which is replaced now
+    const size_t capacity = m_ring.size();
+    for (size_t i = 0; i < m_window_sizes.size(); ++i)
+    {
+        const size_t window_size = static_cast<size_t>(m_window_sizes[i]);
+        if (m_count >= window_size &&
+            value > m_ring[(m_pos + capacity - window_size) % capacity])
+        {
+            ++m_increases[i];
+        }
+    }
+    m_ring[m_pos] = value;
+    m_pos = m_pos + 1 == capacity ? 0 : m_pos + 1;
+    ++m_count;
+}
+
+int runStreaming(const int argc, char *argv[])
+{
+    auto usage = [argv]()
+    {
+        std::cerr << "Usage: " << argv[0] << " [INPUT|-] --windows SIZE[,SIZE...]\n";
+        return 1;
+    };
+
+    std::optional<std::string> input_path;
+    std::optional<std::string_view> windows;
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+        if (arg == "--windows" && i + 1 < argc)
+        {
+            windows = argv[++i];
+        }
+        else if ((arg == "-" || !arg.starts_with("-")) && !input_path)
+        {
+            input_path = arg;
+        }
+        else
+        {
+            return usage();
+        }
+    }
+    if (!windows)
+    {
+        return usage();
+    }
+
+    try
+    {
+        std::vector<int> window_sizes;
+        for (const std::string_view size : aoc::split(*windows, ","))
+        {
+            window_sizes.push_back(aoc::to_number<int>(size));
+        }
+
+        aoc::LineReader in(input_path.value_or(solution().inputFile()));
+        IncreaseCounter counter(window_sizes);
+        std::string_view line;
+        while (in.getline(line))
+        {
+            if (const std::string_view value = aoc::trim(line); !value.empty())
+            {
+                counter.push(aoc::to_number<int>(value));
+            }
+        }
+
+        for (size_t i = 0; i < window_sizes.size(); ++i)
+        {
+            std::cout << counter.increases()[i] << " increases detected in " << window_sizes[i]
+                      << "-value windows\n";
+        }
+    }
+    catch (const std::exception &e)
+    {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+struct Input
+{
+    std::vector<int> values;
+};
+
+Input parse(aoc::LineReader &in)
+{
+    Input input;
+    std::string_view line;
+    while (in.getline(line))
+    {
+        // like reading with operator>>, blank lines and surrounding whitespace are fine
+        if (const std::string_view value = aoc::trim(line); !value.empty())
+        {
+            input.values.push_back(aoc::to_number<int>(value));
+        }
+    }
+    return input;
+}
+
+void part1(const Input &input, std::ostream &os, aoc::ThreadPool &pool)
+{
+    os << "--- Part 1 ---\n";
+    os << countIncreases(input.values, 1, pool) << " increases detected in 1-value windows\n";
+}
+
+void part2(const Input &input, std::ostream &os, aoc::ThreadPool &pool)
+{
+    os << "--- Part 2 ---\n";
+    os << countIncreases(input.values, 3, pool) << " increases detected in 3-value windows\n";
+}
+
+const aoc::Solution &solution()
+{
+    static const aoc::Solution instance("day01", "input1.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day01
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "aoc/solution.h"
+#include "aoc/thread_pool.h"
+
+namespace day01 {
+
+// Instruction sets which countIncreases can be vectorized with
+enum class Isa { SCALAR, SSE2, AVX2 };
+
+const char* isaName(Isa isa);
+
+// Whether the CPU this runs on supports the instruction set
+bool isSupported(Isa isa);
+
+// Number of times the sum of a sliding window increases from one window to the next.
+// Uses the widest instruction set the CPU supports.
+int64_t countIncreases(const std::vector<int>& values, int window_size);
+
+// Same with a given instruction set, which must be supported
+int64_t countIncreases(const std::vector<int>& values, int window_size, Isa isa);
+
+// Same, split into chunks which are counted in parallel on the pool and the calling thread
+int64_t countIncreases(const std::vector<int>& values, int window_size, aoc::ThreadPool& pool);
+
+// Counts the increases of several window sizes in one pass over a stream of values, while only
+// keeping the last values of the largest window in a ring buffer
+class IncreaseCounter {
+   public:
+    explicit IncreaseCounter(std::vector<int> window_sizes);
+
+    void push(int value);
+
+    // by index in the window sizes
+    const std::vector<int64_t>& increases() const { return m_increases; }
+
+   private:
+    std::vector<int> m_window_sizes;
+    std::vector<int64_t> m_increases;
+    std::vector<int> m_ring;  // last values, the oldest at m_pos
+    size_t m_pos{0};
+    uint64_t m_count{0};  // values pushed so far
+};
+
+// Command line entry point of the streaming mode: day01 [INPUT|-] --windows SIZE[,SIZE...]
+// Prints the increases of each window size without holding the whole input in memory.
+int runStreaming(int argc, char* argv[]);
+
+const aoc::Solution& solution();
+
+}  // namespace day01
@@ -0,0 +1,186 @@
+#include "day02.h"
+
+#include <algorithm>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day02 {
+
+Command::Command(const Opcode opcode, const int units) {
+    constexpr int LIMIT = 1 << 29;
+    if (units < -LIMIT || units >= LIMIT) {
+        throw std::out_of_range("Command operand out of range: " + std::to_string(units));
+    }
+    m_packed = units * 4 + static_cast<int32_t>(opcode);
+}
+
+Command parseCommand(const std::string_view line) {
+    const auto [cmd, units_str] = aoc::split_n<2>(line, " ");
+    const int units = aoc::to_number<int>(units_str);
+    if (cmd == "forward") {
+        return Command(Opcode::FORWARD, units);
+    } else if (cmd == "down") {
+        return Command(Opcode::DOWN, units);
+    } else if (cmd == "up") {
+        return Command(Opcode::UP, units);
+    }
+    throw std::invalid_argument("Unknown command: " + std::string(cmd));
+}
+
+namespace {
+
+// Commands per task of the parallel reductions
+constexpr size_t MIN_CHUNK = size_t{1} << 16;
+
+// Transform of each chunk
+std::vector<CourseTransform> reduceChunks(const std::vector<Command> &commands,
+                                          const aoc::Chunks &chunks, aoc::ThreadPool &pool) {
+    std::vector<CourseTransform> transforms(chunks.count);
+    aoc::TaskGroup group(pool);
+    for (size_t chunk = 0; chunk < chunks.count; ++chunk) {
+        group.run([&commands, &chunks, &transforms, chunk]() {
+            transforms[chunk] = reduceCourse(commands, chunks.begin(chunk), chunks.end(chunk));
+        });
+    }
+    group.wait();
+    return transforms;
+}
+
+}  // namespace
+
+CourseTransform reduceCourse(const std::vector<Command> &commands, const size_t begin,
+                             const size_t end) {
+    // a Submarine2 starting at the origin ends up where the transform moves the origin to
+    Submarine2 sub;
+    for (size_t i = begin; i < end; ++i) {
+        sub.followCommand(commands[i].opcode(), commands[i].units());
+    }
+    const Position position = sub.getPosition();
+    return {.forward = position.pos_horiz,
+            .aim_change = position.aim,
+            .depth_change = position.depth};
+}
+
+void Submarine2::followCommands(const std::vector<Command> &commands, aoc::ThreadPool &pool) {
+    const aoc::Chunks chunks = aoc::chunks(commands.size(), pool, MIN_CHUNK);
+    if (chunks.count == 1) {
+        // not worth a task, e.g. for the puzzle input
+        followCommands(commands);
+        return;
+    }
+    CourseTransform course;
+    for (const CourseTransform &transform : reduceChunks(commands, chunks, pool)) {
+        course = course.then(transform);
+    }
+    *this = Submarine2(course.apply(getPosition()));
+}
+
+std::vector<Position> trajectory(const std::vector<Command> &commands, aoc::ThreadPool &pool) {
+    const aoc::Chunks chunks = aoc::chunks(commands.size(), pool, MIN_CHUNK);
+    const std::vector<CourseTransform> transforms = reduceChunks(commands, chunks, pool);
+
+    // exclusive scan: the position at the start of each chunk
+    std::vector<Position> chunk_starts(chunks.count);
+    for (size_t chunk = 1; chunk < chunks.count; ++chunk) {
+        chunk_starts[chunk] = transforms[chunk - 1].apply(chunk_starts[chunk - 1]);
+    }
+
+    std::vector<Position> positions(commands.size());
+    aoc::TaskGroup group(pool);
+    for (size_t chunk = 0; chunk < chunks.count; ++chunk) {
+        group.run([&commands, &chunks, &chunk_starts, &positions, chunk]() {
+            Submarine2 sub(chunk_starts[chunk]);
+            for (size_t i = chunks.begin(chunk); i < chunks.end(chunk); ++i) {
+                sub.followCommand(commands[i].opcode(), commands[i].units());
+                positions[i] = sub.getPosition();
+            }
+        });
+    }
+    group.wait();
+    return positions;
+}
+
+struct Input {
+    std::vector<Command> commands;
+};
+
+Input parse(aoc::LineReader &in) {
+    Input input;
+    std::string_view line;
+    while (in.getline(line)) {
+        // like reading with operator>>, blank lines and surrounding whitespace are fine
+        if (const std::string_view command = aoc::trim(line); !command.empty()) {
+            input.commands.push_back(parseCommand(command));
+        }
+    }
+    return input;
+}
+
+void part1(const Input &input, std::ostream &os) {
+    os << "--- Part 1 ---\n";
+    Submarine sub;
+    sub.followCommands(input.commands);
+    sub.printLocation(os);
+}
+
+void part2(const Input &input, std::ostream &os, aoc::ThreadPool &pool) {
+    os << "--- Part 2 ---\n";
+    Submarine2 sub2;
+    sub2.followCommands(input.commands, pool);
+    sub2.printLocation(os);
+}
+
+int runTrajectory(const int argc, char *argv[]) {
+    auto usage = [argv]() {
+        std::cerr << "Usage: " << argv[0] << " [INPUT|-] --trajectory [-j THREADS]\n";
+        return 1;
+    };
+
+    std::optional<std::string> input_path;
+    std::optional<std::string_view> threads;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--trajectory") continue;
+        if (arg == "-j" && i + 1 < argc) {
+            threads = argv[++i];
+        } else if ((arg == "-" || !arg.starts_with("-")) && !input_path) {
+            input_path = arg;
+        } else {
+            return usage();
+        }
+    }
+
+    try {
+        const int num_threads =
+            threads ? aoc::to_number<int>(*threads)
+                    : static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        if (num_threads < 1) return usage();
+        aoc::LineReader in(input_path.value_or(solution().inputFile()));
+        const Input input = parse(in);
+        // the calling thread runs tasks while waiting, so it counts as one of the threads
+        aoc::ThreadPool pool(static_cast<size_t>(num_threads - 1));
+        for (const Position &position : trajectory(input.commands, pool)) {
+            std::cout << position.pos_horiz << " " << position.depth << " " << position.aim
+                      << "\n";
+        }
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+const aoc::Solution &solution() {
+    static const aoc::Solution instance("day02", "input1.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day02
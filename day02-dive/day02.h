@@ -0,0 +1,144 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+#include <vector>
+
+#include "aoc/solution.h"
+#include "aoc/thread_pool.h"
+
+namespace day02 {
+
+enum class Opcode : uint8_t { FORWARD, DOWN, UP };
+
+// One course command, packed together with its operand into 32 bits
+class Command {
+   public:
+    /// @throws std::out_of_range if units does not fit into 30 bits
+    Command(Opcode opcode, int units);
+
+    Opcode opcode() const { return static_cast<Opcode>(m_packed & 3); }
+    int units() const { return m_packed >> 2; }  // arithmetic shift keeps the sign
+
+   private:
+    int32_t m_packed;  // units * 4 + opcode
+};
+
+// Parse a line like "forward 5"
+/// @throws std::invalid_argument for an unknown command
+Command parseCommand(std::string_view line);
+
+// Common part of the submarine models. The model is the derived class, which implements
+// followCommand(Opcode, int) and is dispatched to statically (CRTP).
+template <typename Model>
+class SubmarineBase {
+   public:
+    void followCommands(const std::vector<Command>& commands) {
+        Model& model = static_cast<Model&>(*this);
+        for (const Command command : commands) {
+            model.followCommand(command.opcode(), command.units());
+        }
+    }
+
+    void printLocation(std::ostream& os) const {
+        os << "Horizontal position: " << m_pos_horiz << ", depth: " << m_depth
+           << ", product of both: " << m_pos_horiz * m_depth << "\n";
+    }
+
+    int64_t getPosHoriz() const { return m_pos_horiz; }
+    int64_t getDepth() const { return m_depth; }
+
+   protected:
+    // 64 bits, since the depth of part 2 grows quadratically with the length of the course
+    int64_t m_pos_horiz{0};
+    int64_t m_depth{0};
+};
+
+// Model of part 1: up and down change the depth directly
+class Submarine : public SubmarineBase<Submarine> {
+   public:
+    // branch-free, since the commands of a course come in no predictable order
+    void followCommand(const Opcode opcode, const int units) {
+        const int forward = opcode == Opcode::FORWARD;
+        const int down = (opcode == Opcode::DOWN) - (opcode == Opcode::UP);
+        m_pos_horiz += forward * units;
+        m_depth += down * units;
+    }
+};
+
+// State of the part 2 model
+struct Position {
+    int64_t pos_horiz{0};
+    int64_t depth{0};
+    int64_t aim{0};
+
+    bool operator==(const Position&) const = default;
+};
+
+// The effect of a sequence of commands on a Position, whatever the start position is. The update
+// of each command is affine in the position, so transforms of consecutive sequences compose.
+struct CourseTransform {
+    int64_t forward{0};       // sum of the forward units
+    int64_t aim_change{0};    // sum of the down units minus the up units
+    int64_t depth_change{0};  // change of depth when starting with zero aim
+
+    // the transform of running this sequence and then next
+    CourseTransform then(const CourseTransform& next) const {
+        return {.forward = forward + next.forward,
+                .aim_change = aim_change + next.aim_change,
+                .depth_change = depth_change + next.depth_change + aim_change * next.forward};
+    }
+
+    Position apply(const Position& position) const {
+        return {.pos_horiz = position.pos_horiz + forward,
+                .depth = position.depth + depth_change + position.aim * forward,
+                .aim = position.aim + aim_change};
+    }
+};
+
+// Model of part 2: up and down change the aim, forward moves along it
+class Submarine2 : public SubmarineBase<Submarine2> {
+   public:
+    Submarine2() = default;
+    explicit Submarine2(const Position& start) : m_aim{start.aim} {
+        m_pos_horiz = start.pos_horiz;
+        m_depth = start.depth;
+    }
+
+    using SubmarineBase::followCommands;
+
+    // Reduces chunks of the commands to CourseTransforms on the threads of the pool and
+    // applies their composition
+    void followCommands(const std::vector<Command>& commands, aoc::ThreadPool& pool);
+
+    void followCommand(const Opcode opcode, const int units) {
+        const int64_t forward = opcode == Opcode::FORWARD;
+        const int64_t down = (opcode == Opcode::DOWN) - (opcode == Opcode::UP);
+        m_pos_horiz += forward * units;
+        m_depth += forward * m_aim * units;
+        m_aim += down * units;
+    }
+
+    Position getPosition() const { return {m_pos_horiz, m_depth, m_aim}; }
+
+   private:
+    int64_t m_aim{0};
+};
+
+// Transform of commands[begin, end)
+CourseTransform reduceCourse(const std::vector<Command>& commands, size_t begin, size_t end);
+
+// The position of the part 2 model after each of the commands, starting at the origin. A
+// parallel prefix scan: the chunks are reduced to transforms in parallel, the transforms are
+// scanned to the start position of each chunk, and then the chunks are replayed in parallel.
+std::vector<Position> trajectory(const std::vector<Command>& commands, aoc::ThreadPool& pool);
+
+// Command line entry point of the trajectory mode: day02 [INPUT|-] --trajectory [-j THREADS]
+// Prints the horizontal position, depth and aim of the part 2 model after each command, scanned
+// on THREADS threads (default: one per hardware thread).
+int runTrajectory(int argc, char* argv[]);
+
+const aoc::Solution& solution();
+
+}  // namespace day02
@@ -0,0 +1,269 @@
+#include "day03.h"
+
+#include <algorithm>
+#include <bit>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "aoc/line_reader.h"
+
+namespace day03 {
+
+namespace {
+
+// Adds weight to the count of every bit set in mask
+void addMask(uint64_t mask, const int64_t weight, int64_t* counts) {
+    for (; mask != 0; mask &= mask - 1) counts[std::countr_zero(mask)] += weight;
+}
+
+// Carry-save adder: adds the bits of a, b and c into a sum (low) and a carry (high) bit
+void csa(uint64_t& high, uint64_t& low, const uint64_t a, const uint64_t b, const uint64_t c) {
+    const uint64_t u = a ^ b;
+    high = (a & b) | (u & c);
+    low = u ^ c;
+}
+
+// Bits of the vertical counter of the sixteens; it is flushed before it can overflow
+constexpr int LEVELS = 16;
+
+// Counts the ones of word `word` of all readings into counts[0, 64). A Harley-Seal carry-save
+// tree adds 16 readings at a time into ones, twos, fours and eights, with one bit of the count of
+// every bit in each; what carries out of that goes into the vertical counter of the sixteens.
+void countOnesOfWord(const Readings& readings, const size_t word, int64_t* counts) {
+    const size_t num_readings = readings.size();
+    auto at = [&readings, word](size_t i) { return readings.reading(i)[word]; };
+
+    uint64_t ones = 0, twos = 0, fours = 0, eights = 0;
+    uint64_t sixteens[LEVELS] = {};
+    size_t num_sixteens = 0;
+    size_t i = 0;
+    for (; i + 16 <= num_readings; i += 16) {
+        uint64_t twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, carry;
+        csa(twos_a, ones, ones, at(i), at(i + 1));
+        csa(twos_b, ones, ones, at(i + 2), at(i + 3));
+        csa(fours_a, twos, twos, twos_a, twos_b);
+        csa(twos_a, ones, ones, at(i + 4), at(i + 5));
+        csa(twos_b, ones, ones, at(i + 6), at(i + 7));
+        csa(fours_b, twos, twos, twos_a, twos_b);
+        csa(eights_a, fours, fours, fours_a, fours_b);
+        csa(twos_a, ones, ones, at(i + 8), at(i + 9));
+        csa(twos_b, ones, ones, at(i + 10), at(i + 11));
+        csa(fours_a, twos, twos, twos_a, twos_b);
+        csa(twos_a, ones, ones, at(i + 12), at(i + 13));
+        csa(twos_b, ones, ones, at(i + 14), at(i + 15));
+        csa(fours_b, twos, twos, twos_a, twos_b);
+        csa(eights_b, fours, fours, fours_a, fours_b);
+        csa(carry, eights, eights, eights_a, eights_b);
+
+        // ripple-carry add to the vertical counter
+        for (uint64_t& level : sixteens) {
+            const uint64_t next_carry = level & carry;
+            level ^= carry;
+            carry = next_carry;
+        }
+        if (++num_sixteens == (size_t{1} << LEVELS) - 1) {
+            for (int level = 0; level < LEVELS; ++level) {
+                addMask(sixteens[level], int64_t{16} << level, counts);
+                sixteens[level] = 0;
+            }
+            num_sixteens = 0;
+        }
+    }
+    for (int level = 0; level < LEVELS; ++level) {
+        addMask(sixteens[level], int64_t{16} << level, counts);
+    }
+    addMask(eights, 8, counts);
+    addMask(fours, 4, counts);
+    addMask(twos, 2, counts);
+    addMask(ones, 1, counts);
+
+    for (; i < num_readings; ++i) addMask(at(i), 1, counts);
+}
+
+bool bitAt(const uint64_t* words, const int bit) { return (words[bit / 64] >> (bit % 64)) & 1; }
+
+// Binary and, if it fits into 64 bits, decimal representation of a packed reading
+std::string describe(const uint64_t* words, const int num_bits) {
+    std::string description = toBinString(words, num_bits) + "b";
+    if (num_bits <= 64) description += " (" + std::to_string(words[0]) + "d)";
+    return description;
+}
+
+// Product of two readings, if it fits into 64 bits
+std::string product(const uint64_t* lhs, const uint64_t* rhs, const int num_bits) {
+    if (num_bits > 32) return "(more than 64 bits)";
+    return std::to_string(lhs[0] * rhs[0]);
+}
+
+}  // namespace
+
+Readings::Readings(const int num_bits)
+    : m_num_bits{num_bits}, m_words_per_reading{(static_cast<size_t>(num_bits) + 63) / 64} {
+    if (num_bits <= 0) throw std::invalid_argument("Readings need at least one bit");
+}
+
+void Readings::push_back(const std::string_view reading) {
+    if (reading.size() != static_cast<size_t>(m_num_bits)) {
+        throw std::invalid_argument("Reading " + std::string(reading) + " does not have " +
+                                    std::to_string(m_num_bits) + " bits");
+    }
+    const size_t first = m_words.size();
+    m_words.resize(first + m_words_per_reading, 0);
+    for (int bit = 0; bit < m_num_bits; ++bit) {
+        const char digit = reading[m_num_bits - 1 - bit];
+        if (digit != '0' && digit != '1') {
+            m_words.resize(first);
+            throw std::invalid_argument("Reading " + std::string(reading) + " is not binary");
+        }
+        m_words[first + bit / 64] |= uint64_t{digit == '1'} << (bit % 64);
+    }
+}
+
+void Readings::sort() {
+    // LSD radix sort over digits of DIGIT_BITS bits, moving whole readings. The counters of a
+    // digit still fit into the L1 cache.
+    constexpr int DIGIT_BITS = 11;
+    constexpr uint64_t DIGIT_MASK = (uint64_t{1} << DIGIT_BITS) - 1;
+    const size_t num_readings = size();
+    std::vector<uint64_t> sorted_words(m_words.size());
+    for (int shift = 0; shift < m_num_bits; shift += DIGIT_BITS) {
+        const size_t word = shift / 64;
+        const int word_shift = shift % 64;
+        // whether the digit continues in the next word
+        const bool split = word_shift > 64 - DIGIT_BITS && word + 1 < m_words_per_reading;
+        auto digit = [this, word, word_shift, split](const size_t i) {
+            const uint64_t* words = reading(i);
+            uint64_t bits = words[word] >> word_shift;
+            if (split) bits |= words[word + 1] << (64 - word_shift);
+            return bits & DIGIT_MASK;
+        };
+
+        std::vector<size_t> offsets(DIGIT_MASK + 1, 0);
+        for (size_t i = 0; i < num_readings; ++i) ++offsets[digit(i)];
+        if (std::find(offsets.begin(), offsets.end(), num_readings) != offsets.end()) {
+            continue;  // all readings have the same digit
+        }
+        std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), size_t{0});
+
+        if (m_words_per_reading == 1) {
+            for (size_t i = 0; i < num_readings; ++i) {
+                sorted_words[offsets[digit(i)]++] = m_words[i];
+            }
+        } else {
+            for (size_t i = 0; i < num_readings; ++i) {
+                const size_t target = offsets[digit(i)]++ * m_words_per_reading;
+                std::copy_n(reading(i), m_words_per_reading, &sorted_words[target]);
+            }
+        }
+        std::swap(m_words, sorted_words);
+    }
+}
+
+std::vector<int64_t> countOnes(const Readings& readings) {
+    std::vector<int64_t> counts(readings.wordsPerReading() * 64, 0);
+    for (size_t word = 0; word < readings.wordsPerReading(); ++word) {
+        countOnesOfWord(readings, word, &counts[word * 64]);
+    }
+    counts.resize(readings.numBits());
+    return counts;
+}
+
+std::string toBinString(const uint64_t* words, const int num_bits) {
+    std::string digits;
+    for (int bit = num_bits - 1; bit >= 0; --bit) digits.push_back(bitAt(words, bit) ? '1' : '0');
+    return digits;
+}
+
+const uint64_t* findRating(const Readings& sorted_readings, const bool keep_most_common) {
+    // the readings left are [begin, end)
+    size_t begin = 0;
+    size_t end = sorted_readings.size();
+    for (int bit = sorted_readings.numBits() - 1; end - begin > 1; --bit) {
+        if (bit < 0) throw std::runtime_error("Too many possibilities");
+        size_t low = begin;
+        size_t high = end;
+        while (low < high) {
+            const size_t mid = low + (high - low) / 2;
+            if (bitAt(sorted_readings.reading(mid), bit)) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        // [begin, low) have a 0 and [low, end) a 1 at bit
+        const size_t one_count = end - low;
+        if (one_count == 0 || one_count == end - begin) continue;
+        const bool ones_most_common = 2 * one_count >= end - begin;
+        if (keep_most_common == ones_most_common) {
+            begin = low;
+        } else {
+            end = low;
+        }
+    }
+    return sorted_readings.reading(begin);
+}
+
+struct Input {
+    Readings readings;
+};
+
+Input parse(aoc::LineReader& in) {
+    std::string_view line;
+    if (!in.getline(line)) throw std::runtime_error("No readings");
+
+    Input input{Readings(static_cast<int>(line.size()))};
+    do {
+        input.readings.push_back(line);
+    } while (in.getline(line));
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    using std::vector;
+
+    os << "--- Part 1 ---\n";
+
+    const Readings& readings = input.readings;
+    const int num_bits = readings.numBits();
+    const vector<int64_t> one_count = countOnes(readings);
+
+    // 1 is the most common bit if at least half of the readings have it
+    vector<uint64_t> gamma(readings.wordsPerReading(), 0);
+    vector<uint64_t> epsilon(readings.wordsPerReading(), 0);
+    const int64_t num_readings = readings.size();
+    for (int bit = 0; bit < num_bits; ++bit) {
+        vector<uint64_t>& set_in = 2 * one_count[bit] >= num_readings ? gamma : epsilon;
+        set_in[bit / 64] |= uint64_t{1} << (bit % 64);
+    }
+
+    os << "Gamma reading: " << describe(gamma.data(), num_bits)
+       << ", epsilon reading: " << describe(epsilon.data(), num_bits) << "\n";
+    os << "Power consumption: " << product(gamma.data(), epsilon.data(), num_bits) << "\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    os << "--- Part 2 ---\n";
+
+    const int num_bits = input.readings.numBits();
+
+    Readings sorted_readings = input.readings;
+    sorted_readings.sort();
+
+    const uint64_t* oxygen_rating = findRating(sorted_readings, true);
+    os << "Oxygen reading: " << describe(oxygen_rating, num_bits) << "\n";
+
+    const uint64_t* co2_rating = findRating(sorted_readings, false);
+    os << "CO2 scrubber reading: " << describe(co2_rating, num_bits) << "\n";
+
+    os << "Life support rating: " << product(oxygen_rating, co2_rating, num_bits) << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day03", "input1.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day03
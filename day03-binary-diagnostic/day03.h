@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc/solution.h"
+
+namespace day03 {
+
+// Diagnostic readings of equal width, packed into bits. Each reading takes wordsPerReading()
+// consecutive words, least significant word first; bit k of a reading is its k-th digit from
+// the right.
+class Readings {
+   public:
+    explicit Readings(int num_bits);
+
+    /// @throws std::invalid_argument if reading has the wrong width or a digit other than 0 and 1
+    void push_back(std::string_view reading);
+
+    int numBits() const { return m_num_bits; }
+    size_t wordsPerReading() const { return m_words_per_reading; }
+    size_t size() const { return m_words.size() / m_words_per_reading; }
+    const uint64_t* reading(const size_t i) const { return &m_words[i * m_words_per_reading]; }
+
+    // Sorts the readings by value
+    void sort();
+
+   private:
+    int m_num_bits;
+    size_t m_words_per_reading;
+    std::vector<uint64_t> m_words;
+};
+
+// Number of readings with bit k set, for each bit k. Counts bit-sliced: the readings are added
+// with carry-save adders into words which each hold one bit of the counts of all 64 bits of a
+// word, and these are only expanded into the counts at the end.
+std::vector<int64_t> countOnes(const Readings& readings);
+
+// The oxygen generator rating (keep_most_common) or the CO2 scrubber rating: filters the readings
+// bit by bit from the left, keeping those with the most common bit (1 if equal) or the least
+// common bit (0 if equal). Readings which all share a bit are all kept.
+// The readings must be sorted. Then the readings left after each bit are a range sharing the
+// bits to the left, whose zeros come before its ones, so each step is one binary search.
+/// @throws std::runtime_error if more than one reading is left after the last bit
+const uint64_t* findRating(const Readings& sorted_readings, bool keep_most_common);
+
+// The binary digits of a packed reading of num_bits bits
+std::string toBinString(const uint64_t* words, int num_bits);
+
+const aoc::Solution& solution();
+
+}  // namespace day03
@@ -0,0 +1,325 @@
+#include "day04.h"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day04 {
+
+namespace {
+
+// Boards per task of the parallel search
+constexpr size_t MIN_CHUNK = size_t{1} << 12;
+
+Winners findWinners(const std::vector<Board>& boards, const DrawRanks& ranks, const size_t begin,
+                    const size_t end) {
+    Winners winners;
+    for (size_t board = begin; board < end; ++board) {
+        winners.add(board, winTime(boards[board], ranks));
+    }
+    return winners;
+}
+
+}  // namespace
+
+int sumUnmarked(const Board& board, const CellMask marked) {
+    int sum_unmarked = 0;
+    for (int cell = 0; cell < BOARD_SIZE * BOARD_SIZE; ++cell) {
+        if (!(marked >> cell & 1)) sum_unmarked += board.numbers[cell];
+    }
+    return sum_unmarked;
+}
+
+BingoSimulator::BingoSimulator(const std::vector<Board>& boards) : m_marked(boards.size(), 0) {
+    if (boards.size() >= (size_t{1} << (32 - CELL_BITS))) {
+        throw std::length_error("Too many boards to simulate");
+    }
+
+    // count the cells of each number, turn the counts into offsets, then fill in the cells
+    for (const Board& board : boards) {
+        for (const int number : board.numbers) {
+            if (number < 0) continue;  // never drawn
+            if (static_cast<size_t>(number) + 1 >= m_offsets.size()) {
+                m_offsets.resize(number + 2, 0);
+            }
+            ++m_offsets[number + 1];
+        }
+    }
+    std::partial_sum(m_offsets.begin(), m_offsets.end(), m_offsets.begin());
+
+    m_cells.resize(m_offsets.empty() ? 0 : m_offsets.back());
+    std::vector<uint32_t> next_cell(m_offsets);
+    for (size_t board = 0; board < boards.size(); ++board) {
+        for (int cell = 0; cell < BOARD_SIZE * BOARD_SIZE; ++cell) {
+            const int number = boards[board].numbers[cell];
+            if (number < 0) continue;
+            m_cells[next_cell[number]++] = static_cast<uint32_t>(board << CELL_BITS | cell);
+        }
+    }
+}
+
+const std::vector<size_t>& BingoSimulator::draw(const int number) {
+    m_winners.clear();
+    if (number < 0 || static_cast<size_t>(number) + 1 >= m_offsets.size()) return m_winners;
+
+    for (uint32_t i = m_offsets[number]; i < m_offsets[number + 1]; ++i) {
+        const size_t board = m_cells[i] >> CELL_BITS;
+        const int cell = m_cells[i] & ((1 << CELL_BITS) - 1);
+        CellMask& marked = m_marked[board];
+        if (marked & WON) continue;
+
+        marked |= CellMask{1} << cell;
+        const CellMask row = LINE_MASKS[cell / BOARD_SIZE];
+        const CellMask col = LINE_MASKS[BOARD_SIZE + cell % BOARD_SIZE];
+        if ((marked & row) == row || (marked & col) == col) {
+            marked |= WON;
+            m_winners.push_back(board);
+        }
+    }
+    return m_winners;
+}
+
+DrawRanks::DrawRanks(std::vector<int> draws) : m_draws{std::move(draws)} {
+    for (int rank = 0; rank < static_cast<int>(m_draws.size()); ++rank) {
+        const int number = m_draws[rank];
+        if (number < 0) continue;  // boards are never searched for negative numbers
+        if (static_cast<size_t>(number) >= m_ranks.size()) m_ranks.resize(number + 1, NEVER);
+        m_ranks[number] = std::min(m_ranks[number], rank);
+    }
+}
+
+int winTime(const Board& board, const DrawRanks& ranks) {
+    std::array<int, BOARD_SIZE * BOARD_SIZE> cell_ranks;
+    for (int cell = 0; cell < BOARD_SIZE * BOARD_SIZE; ++cell) {
+        cell_ranks[cell] = ranks.rank(board.numbers[cell]);
+    }
+
+    int win_time = DrawRanks::NEVER;
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        int row_complete = 0;
+        int col_complete = 0;
+        for (int j = 0; j < BOARD_SIZE; ++j) {
+            row_complete = std::max(row_complete, cell_ranks[i * BOARD_SIZE + j]);
+            col_complete = std::max(col_complete, cell_ranks[j * BOARD_SIZE + i]);
+        }
+        win_time = std::min({win_time, row_complete, col_complete});
+    }
+    return win_time;
+}
+
+int sumUnmarked(const Board& board, const DrawRanks& ranks, const int win_time) {
+    int sum_unmarked = 0;
+    for (const int number : board.numbers) {
+        if (ranks.rank(number) > win_time) sum_unmarked += number;
+    }
+    return sum_unmarked;
+}
+
+void Winners::add(const size_t board, const int time) {
+    if (time == DrawRanks::NEVER) return;
+    if (time < first.time) {
+        first = {board, time};
+        num_first = 1;
+    } else if (time == first.time) {
+        ++num_first;
+    }
+    if (last.time == DrawRanks::NEVER || time >= last.time) last = {board, time};
+}
+
+void Winners::merge(const Winners& later) {
+    if (later.first.time < first.time) {
+        first = later.first;
+        num_first = later.num_first;
+    } else if (later.first.time == first.time) {
+        num_first += later.num_first;
+    }
+    if (later.last.time != DrawRanks::NEVER &&
+        (last.time == DrawRanks::NEVER || later.last.time >= last.time)) {
+        last = later.last;
+    }
+}
+
+Winners findWinners(const std::vector<Board>& boards, const DrawRanks& ranks) {
+    return findWinners(boards, ranks, 0, boards.size());
+}
+
+Winners findWinners(const std::vector<Board>& boards, const DrawRanks& ranks,
+                    aoc::ThreadPool& pool) {
+    const aoc::Chunks chunks = aoc::chunks(boards.size(), pool, MIN_CHUNK);
+    if (chunks.count == 1) return findWinners(boards, ranks);  // not worth a task
+    std::vector<Winners> partial_winners(chunks.count);
+    aoc::TaskGroup group(pool);
+    for (size_t chunk = 0; chunk < chunks.count; ++chunk) {
+        group.run([&boards, &ranks, &chunks, &partial_winners, chunk]() {
+            partial_winners[chunk] =
+                findWinners(boards, ranks, chunks.begin(chunk), chunks.end(chunk));
+        });
+    }
+    group.wait();
+
+    Winners winners;
+    for (const Winners& partial : partial_winners) winners.merge(partial);
+    return winners;
+}
+
+struct Input {
+    std::vector<int> drawn_numbers;
+    std::vector<Board> boards;
+};
+
+// The first line
+std::vector<int> readDraws(aoc::LineReader& in) {
+    std::string_view line;
+    if (!in.getline(line)) throw std::runtime_error("Missing the drawn numbers");
+
+    std::vector<int> drawn_numbers;
+    for (const std::string_view token : aoc::split(line, ",")) {
+        drawn_numbers.push_back(aoc::to_number<int>(aoc::trim(token)));
+    }
+    return drawn_numbers;
+}
+
+// Reads the next board, after its blank line(s); returns false at the end of the input
+bool readBoard(aoc::LineReader& in, const size_t board_index, Board& board) {
+    std::string_view line;
+    // blank lines - when no board follows them, assume we read everything
+    do {
+        if (!in.getline(line)) return false;
+    } while (aoc::trim(line).empty());
+
+    for (int row = 0; row < 5; ++row) {
+        // numbers are right-aligned, so split on single spaces and skip the empty tokens
+        int col = 0;
+        if (row == 0 || in.getline(line)) {
+            for (const std::string_view token : aoc::split(aoc::trim(line), " ")) {
+                if (token.empty()) continue;
+                if (col < 5) board.numbers[row * 5 + col] = aoc::to_number<int>(token);
+                ++col;
+            }
+        }
+        if (col != 5) {
+            std::stringstream ss;
+            ss << "Could not read in row " << row << " of board " << board_index << "\n";
+            throw std::runtime_error(ss.str());
+        }
+    }
+    return true;
+}
+
+Input parse(aoc::LineReader& in) {
+    Input input;
+    input.drawn_numbers = readDraws(in);
+    Board board{};
+    while (readBoard(in, input.boards.size(), board)) input.boards.push_back(board);
+    return input;
+}
+
+void WinnerTracker::push(const Board& board) {
+    const int win_time = winTime(board, m_ranks);
+    m_winners.add(m_num_boards, win_time);
+    // keep the board if it just became the first or the last winner
+    if (win_time != DrawRanks::NEVER) {
+        if (m_winners.first.board == m_num_boards) m_first_board = board;
+        if (m_winners.last.board == m_num_boards) m_last_board = board;
+    }
+    ++m_num_boards;
+}
+
+int runStreaming(const int argc, char* argv[]) {
+    std::optional<std::string> input_path;
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--stream") continue;
+        if ((arg == "-" || !arg.starts_with("-")) && !input_path) {
+            input_path = arg;
+        } else {
+            std::cerr << "Usage: " << argv[0] << " [INPUT|-] --stream\n";
+            return 1;
+        }
+    }
+
+    try {
+        aoc::LineReader in(input_path.value_or(solution().inputFile()));
+        WinnerTracker tracker(readDraws(in));
+        Board board{};
+        while (readBoard(in, tracker.numBoards(), board)) tracker.push(board);
+
+        std::cout << "Read " << tracker.ranks().numDraws() << " numbers and "
+                  << tracker.numBoards() << " boards\n";
+        const Winners& winners = tracker.winners();
+        if (winners.num_first == 0) {
+            std::cout << "No board has won\n";
+            return 0;
+        }
+        auto print_winner = [&tracker](const char* which, const BoardWin& win, const Board& board) {
+            const int num = tracker.ranks().draw(win.time);
+            const int sum_unmarked = sumUnmarked(board, tracker.ranks(), win.time);
+            std::cout << which << " winner: Board " << win.board << " has won with number " << num
+                      << " and score " << sum_unmarked << "*" << num << " = "
+                      << sum_unmarked * num << "\n";
+        };
+        print_winner("First", winners.first, tracker.firstBoard());
+        if (winners.num_first > 1) {
+            std::cout << winners.num_first - 1 << " more boards won with the same number\n";
+        }
+        print_winner("Last", winners.last, tracker.lastBoard());
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << "Read " << input.drawn_numbers.size() << " numbers and " << input.boards.size()
+       << " boards\n";
+
+    os << "--- Part 1 ---\n";
+
+    // play until the first draw with a winner
+    BingoSimulator simulator(input.boards);
+    for (const int num : input.drawn_numbers) {
+        const std::vector<size_t>& winners = simulator.draw(num);
+        for (const size_t board : winners) {
+            const int sum_unmarked = sumUnmarked(input.boards[board], simulator.marked(board));
+            os << "Board " << board << " has won with number " << num << "\n";
+            os << "Its winning score is " << sum_unmarked << "*" << num << " = "
+               << sum_unmarked * num << "\n";
+        }
+        if (!winners.empty()) return;
+    }
+    os << "No board has won\n";
+}
+
+void part2(const Input& input, std::ostream& os, aoc::ThreadPool& pool) {
+    os << "--- Part 2 ---\n";
+
+    const DrawRanks ranks(input.drawn_numbers);
+    const Winners winners = findWinners(input.boards, ranks, pool);
+    if (winners.num_first == 0) {
+        os << "No board has won\n";
+        return;
+    }
+
+    const int win_time = winners.last.time;
+    const int num = ranks.draw(win_time);
+    const int sum_unmarked = sumUnmarked(input.boards[winners.last.board], ranks, win_time);
+    os << "Last winner: Board " << winners.last.board << " has won with number " << num
+       << " and score " << sum_unmarked << "*" << num << " = " << sum_unmarked * num << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day04", "input1.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day04
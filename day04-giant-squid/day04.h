@@ -0,0 +1,146 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "aoc/solution.h"
+#include "aoc/thread_pool.h"
+
+namespace day04 {
+
+constexpr int BOARD_SIZE = 5;
+
+struct Board {
+    std::array<int, BOARD_SIZE * BOARD_SIZE> numbers;  // row by row
+};
+
+// Marked cells of a board: bit row * BOARD_SIZE + col
+using CellMask = uint32_t;
+
+// The cells of each row and each column
+constexpr std::array<CellMask, 2 * BOARD_SIZE> LINE_MASKS = [] {
+    std::array<CellMask, 2 * BOARD_SIZE> masks{};
+    for (int i = 0; i < BOARD_SIZE; ++i) {
+        for (int j = 0; j < BOARD_SIZE; ++j) {
+            masks[i] |= CellMask{1} << (i * BOARD_SIZE + j);               // row i
+            masks[BOARD_SIZE + i] |= CellMask{1} << (j * BOARD_SIZE + i);  // column i
+        }
+    }
+    return masks;
+}();
+
+// Sum of the numbers of the cells not in marked
+int sumUnmarked(const Board& board, CellMask marked);
+
+// Plays the draws on all boards at once. The cells holding a number are found in a flat index
+// (compressed sparse rows: the cells of number n are m_cells[m_offsets[n], m_offsets[n + 1])),
+// so a draw touches contiguous memory, and each board is marked in a 25-bit mask.
+class BingoSimulator {
+   public:
+    explicit BingoSimulator(const std::vector<Board>& boards);
+
+    // Marks number on the boards which have not won yet and returns the boards which win with
+    // it, in board order
+    const std::vector<size_t>& draw(int number);
+
+    CellMask marked(const size_t board) const { return m_marked[board] & ~WON; }
+    bool hasWon(const size_t board) const { return m_marked[board] & WON; }
+
+   private:
+    static constexpr CellMask WON = CellMask{1} << 31;
+    static constexpr int CELL_BITS = 5;  // a cell is board << CELL_BITS | cell index
+
+    std::vector<uint32_t> m_offsets;
+    std::vector<uint32_t> m_cells;
+    std::vector<CellMask> m_marked;  // by board, with WON set when it has won
+    std::vector<size_t> m_winners;
+};
+
+// Looks up when a number is drawn
+class DrawRanks {
+   public:
+    // the rank of numbers which are never drawn
+    static constexpr int NEVER = std::numeric_limits<int>::max();
+
+    explicit DrawRanks(std::vector<int> draws);
+
+    // index of the first draw of number, or NEVER
+    int rank(const int number) const {
+        return number >= 0 && static_cast<size_t>(number) < m_ranks.size() ? m_ranks[number]
+                                                                            : NEVER;
+    }
+    int draw(const int rank) const { return m_draws[rank]; }
+    size_t numDraws() const { return m_draws.size(); }
+
+   private:
+    std::vector<int> m_draws;
+    std::vector<int> m_ranks;  // by number
+};
+
+// Rank of the draw with which the board wins, or NEVER: the earliest row or column to be
+// complete, which is complete with the latest draw of its numbers
+int winTime(const Board& board, const DrawRanks& ranks);
+
+// Sum of the numbers not drawn yet when the board wins at win_time; its score is this times the
+// number drawn at win_time
+int sumUnmarked(const Board& board, const DrawRanks& ranks, int win_time);
+
+struct BoardWin {
+    size_t board{0};
+    int time{DrawRanks::NEVER};
+
+    bool operator==(const BoardWin&) const = default;
+};
+
+// The boards which win first and last. Of boards winning with the same draw, the one with the
+// lowest index wins first and the one with the highest index wins last.
+struct Winners {
+    BoardWin first;
+    BoardWin last;
+    size_t num_first{0};  // number of boards winning together with the first
+
+    void add(size_t board, int time);
+    // adds the winners of boards after those of this
+    void merge(const Winners& later);
+
+    bool operator==(const Winners&) const = default;
+};
+
+Winners findWinners(const std::vector<Board>& boards, const DrawRanks& ranks);
+// The win time of each board is independent of all others, so chunks of boards are reduced to
+// Winners on the threads of the pool
+Winners findWinners(const std::vector<Board>& boards, const DrawRanks& ranks,
+                    aoc::ThreadPool& pool);
+
+// Finds the first and last winner among boards which arrive one at a time, keeping only the draw
+// ranks and those two boards, so memory does not grow with the number of boards
+class WinnerTracker {
+   public:
+    explicit WinnerTracker(std::vector<int> draws) : m_ranks{std::move(draws)} {}
+
+    void push(const Board& board);
+
+    const DrawRanks& ranks() const { return m_ranks; }
+    const Winners& winners() const { return m_winners; }
+    const Board& firstBoard() const { return m_first_board; }
+    const Board& lastBoard() const { return m_last_board; }
+    size_t numBoards() const { return m_num_boards; }
+
+   private:
+    DrawRanks m_ranks;
+    Winners m_winners;
+    Board m_first_board{};
+    Board m_last_board{};
+    size_t m_num_boards{0};
+};
+
+// Command line entry point of the streaming mode: day04 [INPUT|-] --stream
+// Prints the first and last winner, reading the boards one by one into a WinnerTracker.
+int runStreaming(int argc, char* argv[]);
+
+const aoc::Solution& solution();
+
+}  // namespace day04
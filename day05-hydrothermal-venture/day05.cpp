@@ -0,0 +1,683 @@
+#include "day05.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day05 {
+
+bool operator==(const PointXY& lhs, const PointXY& rhs) { return lhs.x == rhs.x && lhs.y == rhs.y; }
+
+bool operator!=(const PointXY& lhs, const PointXY& rhs) { return !(lhs == rhs); }
+
+std::ostream& operator<<(std::ostream& os, const Line& line) {
+    os << "Line(from " << line.start.x << "/" << line.start.y << " to " << line.end.x << "/"
+       << line.end.y << ")";
+    return os;
+}
+
+}  // namespace day05
+
+namespace std {
+template <>
+struct hash<day05::PointXY> {
+    size_t operator()(const day05::PointXY& rhs) const noexcept {
+        static_assert(sizeof(int) * 2 == sizeof(size_t));
+
+        return hash<size_t>()(static_cast<size_t>(rhs.x) << 32 | static_cast<size_t>(rhs.y));
+    }
+};
+}  // namespace std
+
+namespace day05 {
+
+Line parseLine(const std::string_view line_str) {
+    auto parse_point = [](const std::string_view s) -> PointXY {
+        const auto [x_str, y_str] = aoc::split_n<2>(s, ",");
+        return PointXY{.x = aoc::to_number<int>(x_str), .y = aoc::to_number<int>(y_str)};
+    };
+
+    const auto [start_str, end_str] = aoc::split_n<2>(line_str, " -> ");
+    PointXY start = parse_point(start_str);
+    PointXY end = parse_point(end_str);
+
+    return Line{.start = start, .end = end};
+}
+
+bool isSupported(const Line& line) {
+    const int64_t dx = int64_t{line.end.x} - line.start.x;
+    const int64_t dy = int64_t{line.end.y} - line.start.y;
+    return dx == 0 || dy == 0 || std::abs(dx) == std::abs(dy);
+}
+
+namespace {
+
+// Number of points on the line
+int64_t lengthOf(const Line& line) {
+    return std::max(std::abs(int64_t{line.end.x} - line.start.x),
+                    std::abs(int64_t{line.end.y} - line.start.y)) +
+           1;
+}
+
+int64_t countOverlapsHashmap(const std::vector<Line>& lines) {
+    std::unordered_map<PointXY, int> numberOfLinesAtPoint;
+
+    for (const Line& line : lines) {
+        // go from start to end
+        const int dxFull = line.end.x - line.start.x;
+        const int dyFull = line.end.y - line.start.y;
+        const int dx = dxFull != 0 ? dxFull / std::abs(dxFull) : 0;
+        const int dy = dyFull != 0 ? dyFull / std::abs(dyFull) : 0;
+
+        int x = line.start.x;
+        int y = line.start.y;
+        do {
+            const PointXY p{.x = x, .y = y};
+            ++numberOfLinesAtPoint[p];
+            x += dx;
+            y += dy;
+        } while (x != line.end.x || y != line.end.y);
+        // add end point if end is not equal to start
+        if (line.start != line.end) ++numberOfLinesAtPoint[line.end];
+    }
+
+    int64_t numberOfPointsWithAtLeastTwoLines{0};
+    for (const auto& [point, numLines] : numberOfLinesAtPoint) {
+        if (numLines >= 2) ++numberOfPointsWithAtLeastTwoLines;
+    }
+    return numberOfPointsWithAtLeastTwoLines;
+}
+
+// Larger grids are not worth their memory
+constexpr int64_t MAX_DENSE_CELLS = int64_t{1} << 28;
+
+struct BoundingBox {
+    int64_t min_x;
+    int64_t min_y;
+    int64_t max_x;
+    int64_t max_y;
+
+    int64_t width() const { return max_x - min_x + 1; }
+    int64_t height() const { return max_y - min_y + 1; }
+    // saturates instead of overflowing
+    int64_t area() const {
+        return width() > std::numeric_limits<int64_t>::max() / height()
+                   ? std::numeric_limits<int64_t>::max()
+                   : width() * height();
+    }
+};
+
+BoundingBox boundingBoxOf(const std::vector<Line>& lines) {
+    assert(!lines.empty());
+    BoundingBox box{lines[0].start.x, lines[0].start.y, lines[0].start.x, lines[0].start.y};
+    for (const Line& line : lines) {
+        for (const PointXY& p : {line.start, line.end}) {
+            box.min_x = std::min<int64_t>(box.min_x, p.x);
+            box.min_y = std::min<int64_t>(box.min_y, p.y);
+            box.max_x = std::max<int64_t>(box.max_x, p.x);
+            box.max_y = std::max<int64_t>(box.max_y, p.y);
+        }
+    }
+    return box;
+}
+
+int64_t countOverlapsDenseGrid(const std::vector<Line>& lines) {
+    if (lines.empty()) return 0;
+    const BoundingBox box = boundingBoxOf(lines);
+    if (box.area() > MAX_DENSE_CELLS) {
+        throw std::length_error("Bounding box too large for a dense grid");
+    }
+
+    // counters saturate at 2, and a point is counted when its counter reaches 2
+    std::vector<uint8_t> counters(box.area(), 0);
+    int64_t overlaps = 0;
+    for (const Line& line : lines) {
+        const int64_t step_x = line.end.x > line.start.x ? 1 : (line.end.x < line.start.x ? -1 : 0);
+        const int64_t step_y = line.end.y > line.start.y ? 1 : (line.end.y < line.start.y ? -1 : 0);
+        const int64_t stride = step_x + step_y * box.width();
+        int64_t index = (line.start.y - box.min_y) * box.width() + (line.start.x - box.min_x);
+        for (int64_t i = lengthOf(line); i > 0; --i, index += stride) {
+            uint8_t& counter = counters[index];
+            overlaps += counter == 1;
+            counter += counter < 2;
+        }
+    }
+    return overlaps;
+}
+
+// The lines in each of the four directions are told apart by a key, which is constant along a
+// line, and the points on a line by a position, which grows by one from point to point
+enum Family { HORIZONTAL, VERTICAL, DIAGONAL_UP, DIAGONAL_DOWN, NUM_FAMILIES };
+
+struct Point {
+    int64_t x;
+    int64_t y;
+
+    auto operator<=>(const Point&) const = default;
+};
+
+Family familyOf(const Line& line) {
+    if (line.start.y == line.end.y) return HORIZONTAL;  // including single points
+    if (line.start.x == line.end.x) return VERTICAL;
+    return (line.end.x > line.start.x) == (line.end.y > line.start.y) ? DIAGONAL_UP : DIAGONAL_DOWN;
+}
+
+int64_t keyOf(const Family family, const Point& p) {
+    switch (family) {
+        case HORIZONTAL:
+            return p.y;
+        case VERTICAL:
+            return p.x;
+        case DIAGONAL_UP:
+            return p.x - p.y;
+        default:
+            return p.x + p.y;
+    }
+}
+
+int64_t positionOf(const Family family, const Point& p) { return family == VERTICAL ? p.y : p.x; }
+
+Point pointAt(const Family family, const int64_t key, const int64_t position) {
+    switch (family) {
+        case HORIZONTAL:
+            return {position, key};
+        case VERTICAL:
+            return {key, position};
+        case DIAGONAL_UP:
+            return {position, position - key};
+        default:
+            return {position, key - position};
+    }
+}
+
+// The point on line key1 of family1 and line key2 of family2 > family1, unless the lines cross
+// between points (which only diagonals in different directions can do)
+std::optional<Point> crossingOf(const Family family1, const int64_t key1, const Family family2,
+                                const int64_t key2) {
+    assert(family1 < family2);
+    if (family1 == DIAGONAL_UP) {
+        if ((key1 + key2) & 1) return std::nullopt;
+        return Point{(key1 + key2) / 2, (key2 - key1) / 2};
+    }
+    // family1 fixes one coordinate, family2 the other one through its key
+    const Point on_line1 = pointAt(family1, key1, 0);
+    if (family1 == HORIZONTAL) {
+        const int64_t y = on_line1.y;
+        return Point{family2 == VERTICAL ? key2 : (family2 == DIAGONAL_UP ? key2 + y : key2 - y),
+                     y};
+    }
+    const int64_t x = on_line1.x;
+    return Point{x, family2 == DIAGONAL_UP ? x - key2 : key2 - x};
+}
+
+// The points [low, high] of line key of a family
+struct Run {
+    int64_t key;
+    int64_t low;
+    int64_t high;
+};
+
+// Sorted by key and low, without overlapping or adjacent runs
+struct Coverage {
+    std::vector<Run> covered;  // points on at least one line
+    std::vector<Run> doubled;  // points on at least two lines
+};
+
+Coverage coverageOf(const std::vector<Run>& runs) {
+    struct Event {
+        int64_t key;
+        int64_t position;
+        int delta;
+    };
+    std::vector<Event> events;
+    events.reserve(2 * runs.size());
+    for (const Run& run : runs) {
+        events.push_back({run.key, run.low, 1});
+        events.push_back({run.key, run.high + 1, -1});
+    }
+    std::sort(events.begin(), events.end(), [](const Event& lhs, const Event& rhs) {
+        return std::tie(lhs.key, lhs.position) < std::tie(rhs.key, rhs.position);
+    });
+
+    auto extend = [](std::vector<Run>& runs_out, const Run& run) {
+        if (!runs_out.empty() && runs_out.back().key == run.key &&
+            runs_out.back().high + 1 == run.low) {
+            runs_out.back().high = run.high;
+        } else {
+            runs_out.push_back(run);
+        }
+    };
+
+    Coverage coverage;
+    int64_t depth = 0;
+    for (size_t i = 0; i < events.size();) {
+        const int64_t key = events[i].key;
+        const int64_t position = events[i].position;
+        for (; i < events.size() && events[i].key == key && events[i].position == position; ++i) {
+            depth += events[i].delta;
+        }
+        if (depth == 0) continue;
+        // the runs open here end on the same line, so there is a next event
+        const Run run{key, position, events[i].position - 1};
+        extend(coverage.covered, run);
+        if (depth >= 2) extend(coverage.doubled, run);
+    }
+    return coverage;
+}
+
+bool contains(const std::vector<Run>& runs, const int64_t key, const int64_t position) {
+    auto after = std::upper_bound(runs.begin(), runs.end(), std::pair{key, position},
+                                  [](const std::pair<int64_t, int64_t>& point, const Run& run) {
+                                      return point < std::pair{run.key, run.low};
+                                  });
+    if (after == runs.begin()) return false;
+    const Run& run = *std::prev(after);
+    return run.key == key && position <= run.high;
+}
+
+// Whether p is on a line of family
+bool covers(const Coverage& coverage, const Family family, const Point& p) {
+    return contains(coverage.covered, keyOf(family, p), positionOf(family, p));
+}
+
+// Counts the new points where lines of family1 cross lines of family2 > family1. In the plane of
+// (key of family1, key of family2) the covered runs of family1 are at a fixed key1 and cover a
+// range of key2, and those of family2 the other way around. So a sweep over key2 finds the
+// crossings like those of horizontal and vertical segments: a run of family2 crosses the active
+// runs of family1 within its range of key1.
+OverlapCounts countCrossings(const Family family1, const Family family2,
+                             const std::array<Coverage, NUM_FAMILIES>& coverage) {
+    // the keys of family `other` on a run, as [low, high]
+    auto key_range = [](const Family family, const Run& run, const Family other) {
+        return std::minmax({keyOf(other, pointAt(family, run.key, run.low)),
+                            keyOf(other, pointAt(family, run.key, run.high))});
+    };
+
+    enum EventType { INSERT, QUERY, ERASE };
+    struct Event {
+        int64_t key2;
+        EventType type;
+        int64_t key1_low;  // the key1 of the run to insert or erase
+        int64_t key1_high;
+    };
+    const std::vector<Run>& runs1 = coverage[family1].covered;
+    const std::vector<Run>& runs2 = coverage[family2].covered;
+    std::vector<Event> events;
+    events.reserve(2 * runs1.size() + runs2.size());
+    for (const Run& run : runs1) {
+        const auto [low, high] = key_range(family1, run, family2);
+        events.push_back({low, INSERT, run.key, run.key});
+        events.push_back({high, ERASE, run.key, run.key});
+    }
+    for (const Run& run : runs2) {
+        const auto [low, high] = key_range(family2, run, family1);
+        events.push_back({run.key, QUERY, low, high});
+    }
+    std::sort(events.begin(), events.end(), [](const Event& lhs, const Event& rhs) {
+        return std::tie(lhs.key2, lhs.type) < std::tie(rhs.key2, rhs.type);
+    });
+
+    // A point on lines of more than two families is only counted by the two lowest ones. It is
+    // new unless it is on collinear lines already, and it was counted more than once if it is
+    // on collinear lines of several families.
+    OverlapCounts counts;
+    auto count_crossing = [family1, family2, &coverage, &counts](const Point& crossing) {
+        int num_doubled = 0;
+        for (int family = 0; family < NUM_FAMILIES; ++family) {
+            const Family f = static_cast<Family>(family);
+            if (f < family2 && f != family1 && covers(coverage[f], f, crossing)) return;
+            num_doubled += contains(coverage[f].doubled, keyOf(f, crossing),
+                                    positionOf(f, crossing));
+        }
+        if (num_doubled == 0) {
+            ++counts.crossings;
+        } else {
+            counts.collinear -= num_doubled - 1;
+        }
+    };
+
+    // Diagonals of different directions only cross at a point if the sum of their keys is even,
+    // so then the runs of family1 are kept apart by the parity of their key, and a run of family2
+    // only visits those it crosses. Runs on the same key1 cover disjoint ranges of key2, so at
+    // most one of them is active at a time.
+    const bool by_parity = family1 == DIAGONAL_UP && family2 == DIAGONAL_DOWN;
+    auto parity = [by_parity](const int64_t key) { return by_parity ? key & 1 : 0; };
+    std::array<std::set<int64_t>, 2> active;  // key1 of the runs covering the current key2
+    for (const Event& event : events) {
+        switch (event.type) {
+            case INSERT:
+                active[parity(event.key1_low)].insert(event.key1_low);
+                break;
+            case ERASE:
+                active[parity(event.key1_low)].erase(event.key1_low);
+                break;
+            case QUERY: {
+                const std::set<int64_t>& crossing_runs = active[parity(event.key2)];
+                for (auto it = crossing_runs.lower_bound(event.key1_low);
+                     it != crossing_runs.end() && *it <= event.key1_high; ++it) {
+                    if (const auto crossing = crossingOf(family1, *it, family2, event.key2)) {
+                        count_crossing(*crossing);
+                    }
+                }
+                break;
+            }
+        }
+    }
+    return counts;
+}
+
+// Lines or tile slots per task of the tiled rasterisation
+constexpr size_t MIN_CHUNK = size_t{1} << 12;
+
+// A tile of TILE_SIDE x TILE_SIDE uint8_t counters fits into the L2 cache
+constexpr int64_t TILE_SIDE = 512;
+// The lines are binned with a counter per tile for each chunk of lines, so larger planes are not
+// rasterised
+constexpr int64_t MAX_TILES = int64_t{1} << 16;
+
+// A line relative to the bounding box: the points start + t * step for t in [0, length)
+struct Segment {
+    int64_t x;
+    int64_t y;
+    int64_t step_x;
+    int64_t step_y;
+    int64_t length;
+};
+
+Segment segmentOf(const Line& line, const BoundingBox& box) {
+    auto sign = [](const int64_t d) -> int64_t { return (d > 0) - (d < 0); };
+    return {line.start.x - box.min_x, line.start.y - box.min_y,
+            sign(int64_t{line.end.x} - line.start.x), sign(int64_t{line.end.y} - line.start.y),
+            lengthOf(line)};
+}
+
+// The steps [first, last] at which coordinate start + t * step is within [low, high]; empty if
+// first > last
+std::pair<int64_t, int64_t> stepsWithin(const int64_t start, const int64_t step,
+                                        const int64_t length, const int64_t low,
+                                        const int64_t high) {
+    if (step == 0) {
+        return low <= start && start <= high ? std::pair<int64_t, int64_t>{0, length - 1}
+                                             : std::pair<int64_t, int64_t>{0, -1};
+    }
+    if (step > 0) return {std::max<int64_t>(0, low - start), std::min(length - 1, high - start)};
+    return {std::max<int64_t>(0, start - high), std::min(length - 1, start - low)};
+}
+
+// Calls visit(tile) for each tile which the segment passes through, with tiles numbered row by
+// row. In a row of tiles, a line spans at most two tiles unless it is horizontal.
+template <typename Visit>
+void forEachTile(const Segment& segment, const int64_t tiles_per_row, Visit visit) {
+    const int64_t end_y = segment.y + segment.step_y * (segment.length - 1);
+    const auto [low_y, high_y] = std::minmax({segment.y, end_y});
+    for (int64_t row = low_y / TILE_SIDE; row <= high_y / TILE_SIDE; ++row) {
+        const auto [first, last] = stepsWithin(segment.y, segment.step_y, segment.length,
+                                               row * TILE_SIDE, row * TILE_SIDE + TILE_SIDE - 1);
+        const auto [low_x, high_x] = std::minmax(
+            {segment.x + segment.step_x * first, segment.x + segment.step_x * last});
+        for (int64_t col = low_x / TILE_SIDE; col <= high_x / TILE_SIDE; ++col) {
+            visit(static_cast<size_t>(row * tiles_per_row + col));
+        }
+    }
+}
+
+// Adds the part of the segment within the tile at (tile_x, tile_y) to its saturating counters,
+// and returns the number of counters which reach 2
+int64_t rasterise(const Segment& segment, const int64_t tile_x, const int64_t tile_y,
+                  uint8_t* counters) {
+    const auto [first_x, last_x] = stepsWithin(segment.x, segment.step_x, segment.length, tile_x,
+                                               tile_x + TILE_SIDE - 1);
+    const auto [first_y, last_y] = stepsWithin(segment.y, segment.step_y, segment.length, tile_y,
+                                               tile_y + TILE_SIDE - 1);
+    const int64_t first = std::max(first_x, first_y);
+    const int64_t last = std::min(last_x, last_y);
+
+    const int64_t stride = segment.step_x + segment.step_y * TILE_SIDE;
+    int64_t index = (segment.y + segment.step_y * first - tile_y) * TILE_SIDE +
+                    (segment.x + segment.step_x * first - tile_x);
+    int64_t overlaps = 0;
+    for (int64_t t = first; t <= last; ++t, index += stride) {
+        uint8_t& counter = counters[index];
+        overlaps += counter == 1;
+        counter += counter < 2;
+    }
+    return overlaps;
+}
+
+}  // namespace
+
+const char* engineName(const Engine engine) {
+    switch (engine) {
+        case Engine::HASHMAP:
+            return "hashmap";
+        case Engine::DENSE_GRID:
+            return "dense grid";
+        case Engine::SWEEP_LINE:
+            return "sweep line";
+    }
+    return "unknown";
+}
+
+Engine chooseEngine(const std::vector<Line>& lines) {
+    if (lines.empty()) return Engine::HASHMAP;
+
+    int64_t num_points = 0;
+    for (const Line& line : lines) num_points += lengthOf(line);
+    // the dense grid pays for each point of the box, the hashmap for each point of the lines,
+    // and the sweep line for each line and crossing
+    const int64_t area = boundingBoxOf(lines).area();
+    if (area <= MAX_DENSE_CELLS && area / 16 <= num_points) return Engine::DENSE_GRID;
+    return num_points / 16 >= static_cast<int64_t>(lines.size()) ? Engine::SWEEP_LINE
+                                                                  : Engine::HASHMAP;
+}
+
+int64_t countOverlaps(const std::vector<Line>& lines, const Engine engine) {
+    switch (engine) {
+        case Engine::HASHMAP:
+            return countOverlapsHashmap(lines);
+        case Engine::DENSE_GRID:
+            return countOverlapsDenseGrid(lines);
+        case Engine::SWEEP_LINE:
+            return classifyOverlaps(lines).total();
+    }
+    throw std::invalid_argument("Unknown engine");
+}
+
+int64_t countOverlaps(const std::vector<Line>& lines) {
+    return countOverlaps(lines, chooseEngine(lines));
+}
+
+OverlapCounts classifyOverlaps(const std::vector<Line>& lines) {
+    std::array<std::vector<Run>, NUM_FAMILIES> runs;
+    for (const Line& line : lines) {
+        const Family family = familyOf(line);
+        const Point start{line.start.x, line.start.y};
+        const Point end{line.end.x, line.end.y};
+        const auto [low, high] = std::minmax({positionOf(family, start), positionOf(family, end)});
+        runs[family].push_back({keyOf(family, start), low, high});
+    }
+
+    // points on two collinear lines, counted once per family
+    std::array<Coverage, NUM_FAMILIES> coverage;
+    OverlapCounts counts;
+    for (int family = 0; family < NUM_FAMILIES; ++family) {
+        coverage[family] = coverageOf(runs[family]);
+        for (const Run& run : coverage[family].doubled) counts.collinear += run.high - run.low + 1;
+    }
+
+    // points where lines of different families cross
+    for (int family1 = 0; family1 < NUM_FAMILIES; ++family1) {
+        for (int family2 = family1 + 1; family2 < NUM_FAMILIES; ++family2) {
+            const OverlapCounts crossings = countCrossings(
+                static_cast<Family>(family1), static_cast<Family>(family2), coverage);
+            counts.collinear += crossings.collinear;
+            counts.crossings += crossings.crossings;
+        }
+    }
+    return counts;
+}
+
+int64_t countOverlaps(const std::vector<Line>& lines, aoc::ThreadPool& pool) {
+    if (lines.empty()) return 0;
+    int64_t num_points = 0;
+    for (const Line& line : lines) num_points += lengthOf(line);
+    const BoundingBox box = boundingBoxOf(lines);
+    const int64_t tiles_per_row = (box.width() + TILE_SIDE - 1) / TILE_SIDE;
+    const int64_t tiles_per_column = (box.height() + TILE_SIDE - 1) / TILE_SIDE;
+    if (box.area() / 16 > num_points || tiles_per_row * tiles_per_column > MAX_TILES ||
+        lines.size() > std::numeric_limits<uint32_t>::max()) {
+        return countOverlaps(lines);
+    }
+    const size_t num_tiles = tiles_per_row * tiles_per_column;
+
+    // Bin the lines by tile: each chunk of lines counts its lines per tile, and then writes them
+    // to its own slots of the tiles, so no counter is shared between threads
+    const aoc::Chunks line_chunks = aoc::chunks(lines.size(), pool, MIN_CHUNK);
+    std::vector<std::vector<size_t>> slots(line_chunks.count);
+    {
+        aoc::TaskGroup group(pool);
+        for (size_t chunk = 0; chunk < line_chunks.count; ++chunk) {
+            group.run([&lines, &box, &line_chunks, &slots, tiles_per_row, num_tiles, chunk]() {
+                std::vector<size_t>& counts = slots[chunk];
+                counts.assign(num_tiles, 0);
+                for (size_t i = line_chunks.begin(chunk); i < line_chunks.end(chunk); ++i) {
+                    forEachTile(segmentOf(lines[i], box), tiles_per_row,
+                                [&counts](const size_t tile) { ++counts[tile]; });
+                }
+            });
+        }
+        group.wait();
+    }
+    // the lines of tile t are tile_lines[tile_offsets[t], tile_offsets[t + 1]), by chunk
+    std::vector<size_t> tile_offsets(num_tiles + 1, 0);
+    for (size_t tile = 0; tile < num_tiles; ++tile) {
+        size_t offset = tile_offsets[tile];
+        for (std::vector<size_t>& counts : slots) offset += std::exchange(counts[tile], offset);
+        tile_offsets[tile + 1] = offset;
+    }
+    std::vector<uint32_t> tile_lines(tile_offsets[num_tiles]);
+    {
+        aoc::TaskGroup group(pool);
+        for (size_t chunk = 0; chunk < line_chunks.count; ++chunk) {
+            group.run([&lines, &box, &line_chunks, &slots, &tile_lines, tiles_per_row, chunk]() {
+                std::vector<size_t>& next_slot = slots[chunk];
+                for (size_t i = line_chunks.begin(chunk); i < line_chunks.end(chunk); ++i) {
+                    forEachTile(segmentOf(lines[i], box), tiles_per_row, [&](const size_t tile) {
+                        tile_lines[next_slot[tile]++] = static_cast<uint32_t>(i);
+                    });
+                }
+            });
+        }
+        group.wait();
+    }
+    slots.clear();
+
+    // Rasterise the tiles into a tile of counters per task. The tiles are split into ranges of
+    // about the same number of lines.
+    const aoc::Chunks slot_chunks = aoc::chunks(tile_lines.size(), pool, MIN_CHUNK);
+    std::vector<int64_t> partial_overlaps(slot_chunks.count, 0);
+    aoc::TaskGroup group(pool);
+    for (size_t chunk = 0; chunk < slot_chunks.count; ++chunk) {
+        group.run([&, chunk]() {
+            auto tile_at = [&tile_offsets](const size_t slot) {
+                return static_cast<size_t>(
+                    std::upper_bound(tile_offsets.begin(), tile_offsets.end(), slot) -
+                    tile_offsets.begin() - 1);
+            };
+            // the tiles whose first line is in the chunk
+            const size_t begin = slot_chunks.begin(chunk);
+            const size_t end = slot_chunks.end(chunk);
+            if (begin == end) return;
+            const size_t first_tile =
+                tile_offsets[tile_at(begin)] == begin ? tile_at(begin) : tile_at(begin) + 1;
+            const size_t end_tile = tile_at(end - 1) + 1;
+
+            std::vector<uint8_t> counters(TILE_SIDE * TILE_SIDE);
+            int64_t overlaps = 0;
+            for (size_t tile = first_tile; tile < end_tile; ++tile) {
+                if (tile_offsets[tile] == tile_offsets[tile + 1]) continue;
+                std::fill(counters.begin(), counters.end(), 0);
+                const int64_t tile_x = static_cast<int64_t>(tile) % tiles_per_row * TILE_SIDE;
+                const int64_t tile_y = static_cast<int64_t>(tile) / tiles_per_row * TILE_SIDE;
+                for (size_t slot = tile_offsets[tile]; slot < tile_offsets[tile + 1]; ++slot) {
+                    overlaps += rasterise(segmentOf(lines[tile_lines[slot]], box), tile_x, tile_y,
+                                          counters.data());
+                }
+            }
+            partial_overlaps[chunk] = overlaps;
+        });
+    }
+    group.wait();
+
+    int64_t overlaps = 0;
+    for (const int64_t partial : partial_overlaps) overlaps += partial;
+    return overlaps;
+}
+
+struct Input {
+    std::vector<Line> lines;
+};
+
+Input parse(aoc::LineReader& in) {
+    Input input;
+    std::string_view line_str;
+    while (in.getline(line_str)) {
+        // like reading with std::stoi, blank lines and surrounding whitespace are fine
+        line_str = aoc::trim(line_str);
+        if (line_str.empty()) continue;
+        input.lines.emplace_back(parseLine(line_str));
+        if (!isSupported(input.lines.back())) {
+            std::stringstream ss;
+            ss << input.lines.back() << " is neither horizontal, vertical nor diagonal";
+            throw std::invalid_argument(ss.str());
+        }
+    }
+    assert(input.lines.size() > 0);
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os, aoc::ThreadPool& pool) {
+    using std::vector;
+
+    os << "Read " << input.lines.size() << " lines\n";
+    os << " --- Part 1 ---\n";
+
+    vector<Line> relevant_lines;
+    for (const Line& line : input.lines) {
+        // check if horizontal/vertical
+        const bool isHoriz = line.start.x == line.end.x;
+        const bool isVert = line.start.y == line.end.y;
+        if (!(isHoriz || isVert)) continue;
+
+        relevant_lines.push_back(line);
+    }
+
+    os << countOverlaps(relevant_lines, pool) << " points have at least two lines on them\n";
+}
+
+void part2(const Input& input, std::ostream& os, aoc::ThreadPool& pool) {
+    os << " --- Part 2 ---\n";
+
+    os << countOverlaps(input.lines, pool) << " points have at least two lines on them\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day05", "input1.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day05
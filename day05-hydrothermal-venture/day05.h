@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "aoc/solution.h"
+#include "aoc/thread_pool.h"
+
+namespace day05 {
+
+struct PointXY {
+    int x;
+    int y;
+};
+
+struct Line {
+    PointXY start;
+    PointXY end;
+};
+
+// Parse a line like "0,9 -> 5,9"
+Line parseLine(std::string_view line_str);
+
+// Whether the line is horizontal, vertical or diagonal at 45 degrees, which all engines require
+bool isSupported(const Line& line);
+
+// Ways to count the points covered by at least two lines
+enum class Engine {
+    HASHMAP,     // counter per covered point in a hashmap
+    DENSE_GRID,  // saturating uint8_t counter per point of the bounding box
+    SWEEP_LINE,  // from the overlaps of collinear lines and the crossings of the others
+};
+
+const char* engineName(Engine engine);
+
+// DENSE_GRID if the bounding box is small enough to be mostly covered by the lines, otherwise
+// SWEEP_LINE for long lines and HASHMAP for short ones
+Engine chooseEngine(const std::vector<Line>& lines);
+
+// Number of points covered by at least two lines
+/// @throws std::length_error if engine is DENSE_GRID and the bounding box is too large
+int64_t countOverlaps(const std::vector<Line>& lines, Engine engine);
+int64_t countOverlaps(const std::vector<Line>& lines);
+// Rasterises tiles of the bounding box in parallel: the lines are binned by the tiles they pass
+// through, and each task clips the lines of its tiles into its own tile of saturating counters.
+// Planes which are too sparse to rasterise, by the rule of chooseEngine, or have too many tiles
+// are counted as countOverlaps(lines) does.
+int64_t countOverlaps(const std::vector<Line>& lines, aoc::ThreadPool& pool);
+
+// The points covered by at least two lines, by how they are covered
+struct OverlapCounts {
+    int64_t collinear{0};  // points on two lines of the same direction
+    int64_t crossings{0};  // the other points, where lines of different directions cross
+
+    int64_t total() const { return collinear + crossings; }
+};
+
+// Counts analytically, in time growing with the number of lines and crossings but not with their
+// length: collinear lines overlap where their merged runs are doubled, and the crossings of two
+// directions are found by a sweep. This is the SWEEP_LINE engine.
+OverlapCounts classifyOverlaps(const std::vector<Line>& lines);
+
+const aoc::Solution& solution();
+
+}  // namespace day05
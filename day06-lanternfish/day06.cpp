@@ -0,0 +1,241 @@
+#include "day06.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day06 {
+
+std::array<size_t, NUM_TIMERS> simulate_days(std::array<size_t, NUM_TIMERS> timers,
+                                             const int days) {
+    for (int day = 0; day < days; ++day) {
+        // propagate timers
+        const size_t old_count_0 = timers[0];
+        for (int idx = 0; idx < 8; ++idx) {
+            timers[idx] = timers[idx + 1];
+        }
+        timers[6] += old_count_0;  // parents
+        timers[8] = old_count_0;   // newborns
+    }
+
+    return timers;
+}
+
+BigUint::BigUint(const uint64_t value) {
+    for (uint64_t rest = value; rest != 0; rest >>= 32) {
+        m_limbs.push_back(static_cast<uint32_t>(rest));
+    }
+}
+
+void BigUint::trim() {
+    while (!m_limbs.empty() && m_limbs.back() == 0) m_limbs.pop_back();
+}
+
+BigUint& BigUint::operator+=(const BigUint& rhs) {
+    m_limbs.resize(std::max(m_limbs.size(), rhs.m_limbs.size()) + 1, 0);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < m_limbs.size(); ++i) {
+        const uint64_t sum = carry + m_limbs[i] + (i < rhs.m_limbs.size() ? rhs.m_limbs[i] : 0);
+        m_limbs[i] = static_cast<uint32_t>(sum);
+        carry = sum >> 32;
+    }
+    trim();
+    return *this;
+}
+
+BigUint operator*(const BigUint& lhs, const BigUint& rhs) {
+    BigUint product;
+    if (lhs.m_limbs.empty() || rhs.m_limbs.empty()) return product;
+    product.m_limbs.assign(lhs.m_limbs.size() + rhs.m_limbs.size(), 0);
+    for (size_t i = 0; i < lhs.m_limbs.size(); ++i) {
+        // (2^32 - 1)^2 + 2 * (2^32 - 1) still fits into 64 bits
+        uint64_t carry = 0;
+        for (size_t j = 0; j < rhs.m_limbs.size(); ++j) {
+            const uint64_t sum = uint64_t{lhs.m_limbs[i]} * rhs.m_limbs[j] +
+                                 product.m_limbs[i + j] + carry;
+            product.m_limbs[i + j] = static_cast<uint32_t>(sum);
+            carry = sum >> 32;
+        }
+        product.m_limbs[i + rhs.m_limbs.size()] = static_cast<uint32_t>(carry);
+    }
+    product.trim();
+    return product;
+}
+
+std::string BigUint::to_string() const {
+    if (m_limbs.empty()) return "0";
+    // divide by 10^9 until nothing is left, collecting the remainders as groups of 9 digits
+    constexpr uint32_t GROUP = 1'000'000'000;
+    std::vector<uint32_t> rest = m_limbs;
+    std::vector<uint32_t> groups;
+    while (!rest.empty()) {
+        uint64_t remainder = 0;
+        for (size_t i = rest.size(); i-- > 0;) {
+            const uint64_t value = remainder << 32 | rest[i];
+            rest[i] = static_cast<uint32_t>(value / GROUP);
+            remainder = value % GROUP;
+        }
+        groups.push_back(static_cast<uint32_t>(remainder));
+        while (!rest.empty() && rest.back() == 0) rest.pop_back();
+    }
+
+    std::string digits = std::to_string(groups.back());
+    for (size_t i = groups.size() - 1; i-- > 0;) {
+        const std::string group = std::to_string(groups[i]);
+        digits.append(9 - group.size(), '0');
+        digits += group;
+    }
+    return digits;
+}
+
+uint64_t BigUint::to_uint64() const {
+    if (m_limbs.size() > 2) throw std::overflow_error(to_string() + " does not fit into 64 bits");
+    uint64_t value = 0;
+    for (size_t i = m_limbs.size(); i-- > 0;) value = value << 32 | m_limbs[i];
+    return value;
+}
+
+std::ostream& operator<<(std::ostream& os, const BigUint& value) { return os << value.to_string(); }
+
+ModularArithmetic::ModularArithmetic(const uint64_t modulus) : m_modulus{modulus} {
+    if (modulus == 0) throw std::invalid_argument("The modulus must not be 0");
+}
+
+ModularArithmetic::Count ModularArithmetic::mul(Count lhs, Count rhs) const {
+#ifdef __SIZEOF_INT128__
+    __extension__ using Wide = unsigned __int128;
+    return static_cast<Count>(Wide{lhs} * rhs % m_modulus);
+#else
+    if ((lhs | rhs) >> 32 == 0) return lhs * rhs % m_modulus;
+    // double and add
+    Count product = 0;
+    for (; rhs != 0; rhs >>= 1, lhs = add(lhs, lhs)) {
+        if (rhs & 1) product = add(product, lhs);
+    }
+    return product;
+#endif
+}
+
+// After more days even a single fish has more than 2^64 descendants, whatever its timer
+constexpr int MAX_FITTING_DAYS = 600;
+
+size_t count_fish_beyond_table(const std::array<size_t, NUM_TIMERS>& timers, const int days) {
+    if (std::all_of(timers.begin(), timers.end(), [](const size_t fish) { return fish == 0; })) {
+        return 0;
+    }
+    if (days > MAX_FITTING_DAYS) {
+        throw std::overflow_error("More fish after " + std::to_string(days) +
+                                  " days than fit into 64 bits");
+    }
+    FishCounter counter(ExactArithmetic{}, timers);
+    return counter.count_after(static_cast<uint64_t>(days)).to_uint64();
+}
+
+struct Input {
+    // number of fish with respective timers t at index timers[t]
+    std::array<size_t, NUM_TIMERS> timers{};
+};
+
+Input parse(aoc::LineReader& in) {
+    Input input;
+    // read in initial state
+    std::string_view initial_str;
+    if (!in.getline(initial_str)) std::terminate();
+    for (const std::string_view s : aoc::split(initial_str, ",")) {
+        const size_t timer = aoc::to_number<size_t>(aoc::trim(s));
+        if (timer > 8) throw std::runtime_error("invalid timer value");
+
+        ++input.timers[timer];
+    }
+    return input;
+}
+
+// Larger day counts take long to count exactly, as the counts grow by about 9% per day
+constexpr uint64_t MAX_EXACT_DAYS = 100'000;
+
+int runQueries(const int argc, char* argv[]) {
+    auto usage = [argv]() {
+        std::cerr << "Usage: " << argv[0] << " [INPUT|-] --days DAYS[,DAYS...] [--mod P]\n";
+        return 1;
+    };
+
+    std::optional<std::string> input_path;
+    std::vector<uint64_t> days;
+    std::optional<uint64_t> modulus;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string_view arg = argv[i];
+            if (arg == "--days" && i + 1 < argc) {
+                for (const std::string_view day : aoc::split(argv[++i], ",")) {
+                    days.push_back(aoc::to_number<uint64_t>(day));
+                }
+            } else if (arg == "--mod" && i + 1 < argc) {
+                modulus = aoc::to_number<uint64_t>(argv[++i]);
+            } else if ((arg == "-" || !arg.starts_with("-")) && !input_path) {
+                input_path = arg;
+            } else {
+                return usage();
+            }
+        }
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << "\n";
+        return usage();
+    }
+    if (days.empty()) return usage();
+
+    try {
+        aoc::LineReader in(input_path.value_or(solution().inputFile()));
+        const Input input = parse(in);
+        auto print_counts = [&days](const auto& counts, const std::string& suffix) {
+            for (size_t i = 0; i < days.size(); ++i) {
+                std::cout << "At day " << days[i] << " there are " << counts[i] << suffix
+                          << " fish\n";
+            }
+        };
+        if (modulus) {
+            FishCounter counter(ModularArithmetic(*modulus), input.timers);
+            print_counts(counter.count_after(days), " (mod " + std::to_string(*modulus) + ")");
+        } else {
+            if (*std::max_element(days.begin(), days.end()) > MAX_EXACT_DAYS) {
+                throw std::out_of_range("Exact counts are limited to " +
+                                        std::to_string(MAX_EXACT_DAYS) + " days, use --mod");
+            }
+            FishCounter counter(ExactArithmetic{}, input.timers);
+            print_counts(counter.count_after(days), "");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
+
+// the example of the puzzle: 3,4,3,1,2
+static_assert(count_fish({0, 1, 1, 2, 1, 0, 0, 0, 0}, 18) == 26);
+static_assert(count_fish({0, 1, 1, 2, 1, 0, 0, 0, 0}, 80) == 5934);
+static_assert(count_fish({0, 1, 1, 2, 1, 0, 0, 0, 0}, 256) == 26984457539);
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+    os << "At day 80 there are " << count_fish(input.timers, 80) << " fish\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    os << " --- Part 2 ---\n";
+    os << "At day 256 there are " << count_fish(input.timers, 256) << " fish\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day06", "input1.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day06
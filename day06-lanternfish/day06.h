@@ -0,0 +1,205 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "aoc/solution.h"
+
+namespace day06 {
+
+constexpr int NUM_TIMERS = 9;  // timers 0 to 8
+
+// Advances the number of fish with each timer by one day at a time; size_t overflows after
+// about 440 days
+std::array<size_t, NUM_TIMERS> simulate_days(std::array<size_t, NUM_TIMERS> timers, int days);
+
+// The days of both parts
+constexpr int MAX_TABLE_DAYS = 256;
+
+// GROWTH[d][t] is the number of fish after d days which grow from a single fish with timer t
+constexpr std::array<std::array<size_t, NUM_TIMERS>, MAX_TABLE_DAYS + 1> GROWTH = [] {
+    std::array<std::array<size_t, NUM_TIMERS>, MAX_TABLE_DAYS + 1> growth{};
+    growth[0].fill(1);
+    for (int day = 1; day <= MAX_TABLE_DAYS; ++day) {
+        // after a day, a fish with timer t > 0 is one with timer t - 1, and one with timer 0 is
+        // one with timer 6 and a newborn with timer 8
+        growth[day][0] = growth[day - 1][6] + growth[day - 1][8];
+        for (int timer = 1; timer < NUM_TIMERS; ++timer) {
+            growth[day][timer] = growth[day - 1][timer - 1];
+        }
+    }
+    return growth;
+}();
+
+// count_fish beyond the table, counted exactly by a FishCounter
+/// @throws std::overflow_error if the count does not fit into size_t
+size_t count_fish_beyond_table(const std::array<size_t, NUM_TIMERS>& timers, int days);
+
+// The number of fish after days: the dot product of the timers with GROWTH[days]
+/// @throws std::invalid_argument if days is negative
+/// @throws std::overflow_error if the count does not fit into size_t
+constexpr size_t count_fish(const std::array<size_t, NUM_TIMERS>& timers, const int days) {
+    if (days < 0) throw std::invalid_argument("Negative number of days");
+    if (days > MAX_TABLE_DAYS) return count_fish_beyond_table(timers, days);
+    size_t count = 0;
+    for (int timer = 0; timer < NUM_TIMERS; ++timer) {
+        size_t fish = 0;
+        if (__builtin_mul_overflow(timers[timer], GROWTH[days][timer], &fish) ||
+            __builtin_add_overflow(count, fish, &count)) {
+            throw std::overflow_error("More fish than fit into 64 bits");
+        }
+    }
+    return count;
+}
+
+// Unsigned integer of any size, for exact fish counts
+class BigUint {
+   public:
+    BigUint() = default;
+    explicit BigUint(uint64_t value);
+
+    BigUint& operator+=(const BigUint& rhs);
+    friend BigUint operator+(BigUint lhs, const BigUint& rhs) { return lhs += rhs; }
+    friend BigUint operator*(const BigUint& lhs, const BigUint& rhs);
+    friend bool operator==(const BigUint& lhs, const BigUint& rhs) = default;
+
+    // decimal digits
+    std::string to_string() const;
+    /// @throws std::overflow_error if the value does not fit
+    uint64_t to_uint64() const;
+
+   private:
+    std::vector<uint32_t> m_limbs;  // least significant first, without leading zeros
+
+    void trim();
+};
+
+std::ostream& operator<<(std::ostream& os, const BigUint& value);
+
+// Arithmetic of fish counts for FishCounter: exact
+struct ExactArithmetic {
+    using Count = BigUint;
+
+    Count from(const uint64_t value) const { return BigUint(value); }
+    Count add(const Count& lhs, const Count& rhs) const { return lhs + rhs; }
+    Count mul(const Count& lhs, const Count& rhs) const { return lhs * rhs; }
+};
+
+// Arithmetic of fish counts for FishCounter: modulo a modulus
+class ModularArithmetic {
+   public:
+    using Count = uint64_t;
+
+    /// @throws std::invalid_argument if modulus is 0
+    explicit ModularArithmetic(uint64_t modulus);
+
+    uint64_t modulus() const { return m_modulus; }
+
+    Count from(const uint64_t value) const { return value % m_modulus; }
+    Count add(const Count lhs, const Count rhs) const {
+        return lhs >= m_modulus - rhs ? lhs - (m_modulus - rhs) : lhs + rhs;
+    }
+    Count mul(Count lhs, Count rhs) const;
+
+   private:
+    uint64_t m_modulus;
+};
+
+// Counts the fish after any number of days with powers of the 9x9 matrix which advances the
+// timers by one day, so a day count of d takes O(log d) steps instead of d. The powers advancing
+// by 2^k days are squared once and kept, so all queries share them, and a query only multiplies
+// the initial timers with the powers of the bits set in its day count.
+template <typename Arithmetic>
+class FishCounter {
+   public:
+    using Count = typename Arithmetic::Count;
+    using Timers = std::array<Count, NUM_TIMERS>;
+
+    FishCounter(Arithmetic arithmetic, const std::array<size_t, NUM_TIMERS>& timers)
+        : m_arithmetic{std::move(arithmetic)} {
+        for (int timer = 0; timer < NUM_TIMERS; ++timer) {
+            m_timers[timer] = m_arithmetic.from(timers[timer]);
+        }
+        // a fish with timer t > 0 has timer t - 1 the next day, one with timer 0 has timer 6 and
+        // a newborn with timer 8
+        Matrix day = zero_matrix();
+        for (int timer = 1; timer < NUM_TIMERS; ++timer) {
+            day[timer][timer - 1] = m_arithmetic.from(1);
+        }
+        day[0][6] = m_arithmetic.from(1);
+        day[0][8] = m_arithmetic.from(1);
+        m_powers.push_back(std::move(day));
+    }
+
+    // The number of fish with each timer after days
+    Timers timers_after(uint64_t days) {
+        Timers timers = m_timers;
+        for (size_t bit = 0; days != 0; ++bit, days >>= 1) {
+            if (bit == m_powers.size()) {
+                m_powers.push_back(multiply(m_powers.back(), m_powers.back()));
+            }
+            if (days & 1) timers = multiply(timers, m_powers[bit]);
+        }
+        return timers;
+    }
+
+    Count count_after(const uint64_t days) {
+        const Timers timers = timers_after(days);
+        Count count = m_arithmetic.from(0);
+        for (const Count& fish : timers) count = m_arithmetic.add(count, fish);
+        return count;
+    }
+
+    // The count after each of days
+    std::vector<Count> count_after(const std::vector<uint64_t>& days) {
+        std::vector<Count> counts;
+        counts.reserve(days.size());
+        for (const uint64_t day : days) counts.push_back(count_after(day));
+        return counts;
+    }
+
+   private:
+    using Matrix = std::array<Timers, NUM_TIMERS>;  // [timer before][timer after]
+
+    Arithmetic m_arithmetic;
+    Timers m_timers;
+    std::vector<Matrix> m_powers;  // m_powers[k] advances the timers by 2^k days
+
+    Matrix zero_matrix() const {
+        Matrix matrix;
+        for (Timers& row : matrix) row.fill(m_arithmetic.from(0));
+        return matrix;
+    }
+
+    Timers multiply(const Timers& timers, const Matrix& matrix) const {
+        Timers result;
+        result.fill(m_arithmetic.from(0));
+        for (int from = 0; from < NUM_TIMERS; ++from) {
+            for (int to = 0; to < NUM_TIMERS; ++to) {
+                result[to] =
+                    m_arithmetic.add(result[to], m_arithmetic.mul(timers[from], matrix[from][to]));
+            }
+        }
+        return result;
+    }
+
+    Matrix multiply(const Matrix& lhs, const Matrix& rhs) const {
+        Matrix result;
+        for (int row = 0; row < NUM_TIMERS; ++row) result[row] = multiply(lhs[row], rhs);
+        return result;
+    }
+};
+
+// Command line entry point of the query mode: day06 [INPUT|-] --days DAYS[,DAYS...] [--mod P]
+// Prints the number of fish after each of the day counts, exactly or modulo P.
+int runQueries(int argc, char* argv[]);
+
+const aoc::Solution& solution();
+
+}  // namespace day06
@@ -0,0 +1,87 @@
+#include "day07.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day07 {
+
+struct Input {
+    std::vector<int> positions;
+};
+
+Input parse(aoc::LineReader& in) {
+    Input input;
+    // read in initial state
+    std::string_view str;
+    if (!in.getline(str)) std::terminate();
+    for (const std::string_view s : aoc::split(str, ",")) {
+        const int pos = aoc::to_number<int>(aoc::trim(s));
+        input.positions.push_back(pos);
+    }
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+    // find the median (or any of the two middle values if size is even)
+    // could sort, but quickselect is better (which is hopefully done by std::nth_element)
+    std::vector<int> positions = input.positions;
+    assert(positions.size() > 0);
+    auto it_median = positions.begin() + positions.size()/2;
+    std::nth_element(positions.begin(), it_median, positions.end());
+
+    const int target_pos = *it_median;
+    auto cost = [&positions](const int target) -> int {
+        // cost if going to target
+        int sum = 0;
+        for (const int pos : positions) {
+            sum += std::abs(pos - target);
+        }
+        return sum;
+    };
+
+    os << "(Possible) target position: " << target_pos << ", optimal cost: " << cost(target_pos) << " fuel\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    using std::vector;
+
+    os << " --- Part 2 ---\n";
+    // Calculate mean but check integer values below and above for lowest cost
+    auto avg = [](const vector<int>& values) -> double {
+        if (values.empty()) throw std::invalid_argument("Cannot calc avg of empty vector");
+        // assumes sum is small enough. Could use alternative formula.
+        return std::reduce(values.begin(), values.end(), 0) / static_cast<double>(values.size());
+    };
+
+    const vector<int>& positions = input.positions;
+    const double dbl_mean = avg(positions);
+    const int cand1 = std::floor(dbl_mean);
+    const int cand2 = std::ceil(dbl_mean);
+
+    auto cost = [&positions](const int target) -> int {
+        int sum = 0;
+        for (const int pos : positions) {
+            const int dist = std::abs(target - pos);
+            sum += dist*(dist+1)/2; // Gaussian sum for 1,2,...,dist
+        }
+        return sum;
+    };
+    os << "Minimal cost: " << std::min(cost(cand1), cost(cand2)) << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day07", "input1.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day07
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "aoc/solution.h"
+
+namespace day07 {
+
+const aoc::Solution& solution();
+
+}  // namespace day07
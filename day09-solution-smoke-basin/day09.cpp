@@ -0,0 +1,152 @@
+#include "day09.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include "aoc/line_reader.h"
+
+namespace day09 {
+
+using HeightMap = std::vector<std::vector<int>>;
+
+struct Coord {
+    int row;
+    int col;
+};
+
+bool is_valid(const HeightMap& data, const int row, const int col) {
+    return row >= 0 && row < static_cast<int>(data.size()) && col >= 0 &&
+           col < static_cast<int>(data[0].size());
+}
+
+int lowest_neighbor_val(const HeightMap& data, const int row, const int col) {
+    int lowest = 10;
+    auto check = [&lowest, &data](const int row, const int col) -> void {
+        if (is_valid(data, row, col)) {
+            lowest = std::min(lowest, data[row][col]);
+        }
+    };
+    check(row - 1, col);
+    check(row + 1, col);
+    check(row, col - 1);
+    check(row, col + 1);
+
+    return lowest;
+}
+
+std::vector<Coord> find_low_points(const HeightMap& data) {
+    std::vector<Coord> lowest_points;
+    for (int row = 0; row < static_cast<int>(data.size()); ++row) {
+        for (int col = 0; col < static_cast<int>(data[0].size()); ++col) {
+            const int val = data[row][col];
+            if (val < lowest_neighbor_val(data, row, col)) {
+                lowest_points.emplace_back(Coord{.row = row, .col = col});
+            }
+        }
+    }
+    return lowest_points;
+}
+
+struct Input {
+    HeightMap data;
+};
+
+Input parse(aoc::LineReader& in) {
+    Input input;
+    // read in input
+    std::string_view line;
+    while (in.getline(line)) {
+        input.data.emplace_back();
+        for (const char c : line) {
+            const int num = c - '0';
+            assert(num >= 0 && num <= 9);
+            input.data.back().push_back(num);
+        }
+    }
+    assert(input.data.size() > 0);
+    for ([[maybe_unused]] const auto& row : input.data) {
+        assert(row.size() == input.data.front().size());
+    }
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+
+    const HeightMap& data = input.data;
+
+    int sum_of_lowest_risks = 0;
+    for (const Coord& coord : find_low_points(data)) {
+        sum_of_lowest_risks += 1 + data[coord.row][coord.col];
+    }
+    os << "Sum of lowest risks: " << sum_of_lowest_risks << "\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    using std::vector;
+
+    os << " --- Part 2 ---\n";
+
+    const HeightMap& data = input.data;
+
+    const int rows = static_cast<int>(data.size());
+    const int cols = static_cast<int>(data[0].size());
+    vector<vector<bool>> visited(
+        rows, vector<bool>(cols, false));  // could also mark visited as 9 fields
+
+    auto find_basin_size = [&data, &visited](const Coord& low_point) -> int {
+        // find size of basin of low point with DFS
+
+        int num_points = 0;
+
+        auto dfs = [&](const int row, const int col, const int last_val, auto& dfs) -> void {
+            // DFS - only recurse if this point is valid and part of basin
+            // Must be called from low-point initially with last_val = -1
+            // Alternative would be to simply grow outwards until a 9 is encountered
+            if (!is_valid(data, row, col)) return;
+            if (visited[row][col]) return;
+            const int val = data[row][col];
+            if (val <= last_val || val == 9) return;
+
+            visited[row][col] = true;
+            ++num_points;
+
+            dfs(row - 1, col, val, dfs);
+            dfs(row + 1, col, val, dfs);
+            dfs(row, col - 1, val, dfs);
+            dfs(row, col + 1, val, dfs);
+        };
+
+        dfs(low_point.row, low_point.col, -1, dfs);
+        return num_points;
+    };
+
+    // find 3 largest basins
+    // could use a min-heap with size 3 for this... but not worth it for such a small map
+    vector<int> basin_sizes;
+    for (const auto& low_point : find_low_points(data)) {
+        basin_sizes.push_back(find_basin_size(low_point));
+    }
+    std::sort(basin_sizes.begin(), basin_sizes.end(),
+              std::greater<>());  // so that largest are in front
+
+    const std::array<int, 3> largest_basins = {basin_sizes.at(0), basin_sizes.at(1),
+                                               basin_sizes.at(2)};
+    os << "3 largest basin sizes: ";
+    for (const int sz : largest_basins) os << sz << " ";
+    os << "\n";
+    const int prod = largest_basins[0] * largest_basins[1] * largest_basins[2];
+    os << "Their product: " << prod << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day09", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day09
@@ -0,0 +1,191 @@
+#include "day10.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "aoc/line_reader.h"
+
+namespace day10 {
+
+const std::unordered_map<char, char> expected_closing_char{
+    {'(', ')'}, {'[', ']'}, {'{', '}'}, {'<', '>'}};
+
+std::optional<char> find_first_invalid_char(const std::string& line) {
+    std::vector<char> expected_stack;  // could also use string
+    for (const char c : line) {
+        switch (c) {
+            case '(':
+            case '[':
+            case '{':
+            case '<': {
+                expected_stack.push_back(expected_closing_char.find(c)->second);
+                break;
+            }
+            default: {
+                // closing char
+                if (!expected_stack.empty() && expected_stack.back() == c) {
+                    expected_stack.pop_back();
+                } else {
+                    // invalid char
+                    return c;
+                }
+                break;
+            }
+        }
+    }
+    return {};
+}
+
+struct Input {
+    std::vector<std::string> lines;
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    Input input;
+    // read in lines
+    std::string_view line;
+    while (in.getline(line)) {
+        // check content
+        for (const char c : line) {
+            switch (c) {
+                case '(':
+                case ')':
+                case '[':
+                case ']':
+                case '{':
+                case '}':
+                case '<':
+                case '>': {
+                    break;
+                }
+                default: {
+                    throw std::runtime_error(std::string("Invalid character: ") + c);
+                }
+            }
+        }
+        input.lines.emplace_back(std::move(line));
+    }
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+
+    // stop at first incorrect closing bracket and count the scores of the illegal char
+    int total_score = 0;
+    const std::unordered_map<char, int> score_by_char{
+        {')', 3}, {']', 57}, {'}', 1197}, {'>', 25137}};
+
+    for (const std::string& line : input.lines) {
+        const std::optional<char> first_invalid = find_first_invalid_char(line);
+        if (first_invalid.has_value()) {
+            total_score += score_by_char.find(first_invalid.value())->second;
+        }
+    }
+    os << "Total score: " << total_score << "\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    using std::string;
+    using std::vector;
+
+    os << " --- Part 2 ---\n";
+
+    vector<string> incomplete_lines;
+    for (const string& line : input.lines) {
+        if (!find_first_invalid_char(line).has_value()) {
+            // is not invalid, but may be not complete
+            incomplete_lines.push_back(line);
+        }
+    }
+
+    auto find_completion_string = [](const string& line) -> string {
+        // find the string that completes the incomplete (but not invalid) line
+
+        string expected_stack;
+        for (const char c : line) {
+            switch (c) {
+                case '(':
+                case '[':
+                case '{':
+                case '<': {
+                    expected_stack.push_back(expected_closing_char.find(c)->second);
+                    break;
+                }
+                default: {
+                    // closing char
+                    if (!expected_stack.empty() && expected_stack.back() == c) {
+                        expected_stack.pop_back();
+                    } else {
+                        // invalid char
+                        throw std::runtime_error(
+                            "Cannot find completion string for invalid string");
+                    }
+                    break;
+                }
+            }
+        }
+        std::reverse(expected_stack.begin(), expected_stack.end());
+        return expected_stack;
+    };
+
+    auto find_completion_score =
+        [&find_completion_string](const string& incomplete_line) -> int64_t {
+        int64_t score = 0;
+        for (const char c : find_completion_string(incomplete_line)) {
+            score *= 5;
+            switch (c) {
+                case ')': {
+                    score += 1;
+                    break;
+                }
+                case ']': {
+                    score += 2;
+                    break;
+                }
+                case '}': {
+                    score += 3;
+                    break;
+                }
+                case '>': {
+                    score += 4;
+                    break;
+                }
+                default: {
+                    throw std::runtime_error("Insensible completion char");
+                    break;
+                }
+            }
+        }
+        return score;
+    };
+
+    vector<int64_t> scores;
+    for (const string& line : incomplete_lines) {
+        // os << find_completion_string(line) << " -> " << find_completion_score(line) <<
+        // "\n";
+        scores.push_back(find_completion_score(line));
+    }
+
+    assert(scores.size() > 0);
+    auto it_mid = scores.begin() + scores.size() / 2;
+    std::nth_element(scores.begin(), it_mid, scores.end());
+    os << "Middle score: " << *it_mid << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day10", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day10
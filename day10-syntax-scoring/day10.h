@@ -0,0 +1,9 @@
+#pragma once
+
+#include "aoc/solution.h"
+
+namespace day10 {
+
+const aoc::Solution& solution();
+
+}  // namespace day10
@@ -0,0 +1,165 @@
+#include "day11.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "aoc/line_reader.h"
+
+namespace day11 {
+
+using Grid = std::vector<std::vector<int>>;
+
+[[maybe_unused]] void print(const Grid& grid) {
+    for (const auto& row : grid) {
+        for (const int elem : row) {
+            std::cout << elem << "|";
+        }
+        std::cout << "\n";
+    }
+}
+
+// Simulate one step, calling flash_handler() for every flash
+template <typename FlashHandler>
+void step(Grid& grid, FlashHandler& flash_handler) {
+    using std::array;
+
+    auto increment_all = [&grid]() -> void {
+        // increment all cells in grid by 1 without any checks or recursion
+        for (auto& row : grid) {
+            for (int& elem : row) {
+                ++elem;
+            }
+        }
+    };
+
+    const int rows = grid.size();
+    const int cols = grid[0].size();
+
+    auto is_valid = [rows, cols](const int row, const int col) -> bool {
+        return row >= 0 && row < rows && col >= 0 && col < cols;
+    };
+
+    auto shine_on = [&grid, &is_valid](const int row, const int col, auto& shine_on,
+                                       auto& check_flash, auto& flash_handler) -> void {
+        // simulate that a light shines on this cell. May recurse.
+        if (!is_valid(row, col)) throw std::runtime_error("Cannot shine_on invalid cell");
+        int& val = grid[row][col];
+        if (val == 0) return;   // did already flash this step
+        if (val == 10) return;  // will flash anyway this step later
+
+        ++val;
+        check_flash(row, col, shine_on, check_flash, flash_handler);
+    };
+
+    auto check_flash = [&grid, &is_valid](const int row, const int col, auto& shine_on,
+                                          auto& check_flash, auto& flash_handler) -> void {
+        // check if this field must flash, and flash if so and shine on others
+        if (!is_valid(row, col)) throw std::runtime_error("Cannot check_flash on invalid cell");
+        int& val = grid[row][col];
+        if (val != 10) return;  // will not flash
+
+        // flash
+        val = 0;
+        flash_handler();
+
+        // and shine on neighbors
+        const array<array<int, 2>, 8> deltas = {
+            {{-1, -1}, {-1, 0}, {-1, +1}, {0, -1}, {0, +1}, {+1, -1}, {+1, 0}, {+1, +1}}};
+
+        for (const auto [drow, dcol] : deltas) {
+            const int nb_row = row + drow;
+            const int nb_col = col + dcol;
+            if (is_valid(nb_row, nb_col))
+                shine_on(nb_row, nb_col, shine_on, check_flash, flash_handler);
+        }
+    };
+
+    increment_all();
+
+    for (int row = 0; row < rows; ++row) {
+        for (int col = 0; col < cols; ++col) {
+            check_flash(row, col, shine_on, check_flash, flash_handler);
+        }
+    }
+}
+
+struct Input {
+    Grid grid;
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    Input input;
+    // read in lines
+    std::string_view line;
+    while (in.getline(line)) {
+        input.grid.emplace_back();
+        for (const char c : line) {
+            const int val = c - '0';
+            assert(0 <= val && val <= 9);
+            input.grid.back().push_back(val);
+        }
+    }
+    assert(!input.grid.empty() && !input.grid[0].empty());
+    // check if valid
+    for (size_t row = 0; row < input.grid.size(); ++row) {
+        assert(input.grid[row].size() == input.grid[0].size());
+    }
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+    Grid grid = input.grid;
+    int num_flashes = 0;
+    auto flash_handler = [&num_flashes]() -> void { ++num_flashes; };
+
+    const int steps = 100;
+    // print(grid);
+    for (int i = 0; i < steps; ++i) {
+        step(grid, flash_handler);
+        // std::cout << "---\n";
+        // print(grid);
+    }
+    os << num_flashes << " flashes happened\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    using std::vector;
+
+    os << " --- Part 2 ---\n";
+    Grid grid = input.grid;
+
+    auto is_all_zeros = [&grid]() -> bool {
+        for (const vector<int>& row : grid) {
+            for (const int elem : row) {
+                if (elem != 0) return false;
+            }
+        }
+        return true;
+    };
+
+    auto flash_handler = []() -> void {};
+
+    for (int i = 0; i < 9999; ++i) {
+        if (is_all_zeros()) {
+            os << "grid is all zeros after step " << i << "\n";
+            break;
+        }
+        step(grid, flash_handler);
+    }
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day11", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day11
@@ -0,0 +1,128 @@
+#include "day12.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day12 {
+
+using AdjacencyList = std::unordered_map<std::string, std::vector<std::string>>;
+
+void searchGraph1(const std::string& node,
+                  const AdjacencyList& adj,
+                  std::unordered_set<std::string>& visited, int& path_count) {
+    if (node == "end") {
+        ++path_count;
+        return;
+    }
+    if (visited.find(node) != visited.end()) {
+        // already visited this small cave
+        return;
+    }
+    if (node[0] >= 'a' && node[0] <= 'z') {
+        // small cave -> mark as visited
+        visited.insert(node);
+    }
+
+    for (const std::string& neighbor : adj.at(node)) {
+        searchGraph1(neighbor, adj, visited, path_count);
+    }
+
+    visited.erase(node);
+}
+
+void searchGraph2(const std::string& node,
+                  const AdjacencyList& adj,
+                  std::unordered_map<std::string, int>& visited_count,
+                  bool& visited_a_small_cave_twice, int& path_count) {
+    if (node == "end") {
+        ++path_count;
+        return;
+    }
+
+    const bool is_small_cave = node[0] >= 'a' && node[0] <= 'z';
+
+    if (is_small_cave) {
+        if (visited_count[node] == 2) {
+            // already visited this small cave twice
+            return;
+        } else if (visited_count[node] == 1) {
+            // can visit this once more if no other small cave was yet visited twice
+            if (visited_a_small_cave_twice) {
+                return;
+            } else {
+                visited_a_small_cave_twice = true;
+            }
+        } 
+        // mark as visited once more
+        ++visited_count[node];
+    }
+
+    for (const std::string& neighbor : adj.at(node)) {
+        if (neighbor == "start") continue;
+        searchGraph2(neighbor, adj, visited_count, visited_a_small_cave_twice, path_count);
+    }
+
+    if (is_small_cave) {
+        if (visited_count[node] == 2) {
+            // this was the one visited twice
+            visited_a_small_cave_twice = false;
+        }
+        --visited_count[node];
+    }
+}
+
+struct Input {
+    AdjacencyList adj;
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    Input input;
+    // read in lines
+    std::string_view line;
+    while (in.getline(line)) {
+        const auto [from, to] = aoc::split_n<2>(line, "-");
+
+        input.adj[string(from)].emplace_back(to);
+        input.adj[string(to)].emplace_back(from);
+    }
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+
+    std::unordered_set<std::string> visited;
+    int path_count{0};
+    searchGraph1("start", input.adj, visited, path_count);
+
+    os << "Path count: " << path_count << "\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    os << " --- Part 2 ---\n";
+    std::unordered_map<std::string, int> visited_count;
+    int path_count{0};
+    bool visited_a_small_cave_twice{false};
+    searchGraph2("start", input.adj, visited_count, visited_a_small_cave_twice, path_count);
+
+    os << "Path count: " << path_count << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day12", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day12
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "aoc/solution.h"
+
+namespace day12 {
+
+const aoc::Solution& solution();
+
+}  // namespace day12
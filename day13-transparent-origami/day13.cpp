@@ -0,0 +1,201 @@
+#include "day13.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day13 {
+
+class Grid {
+   public:
+    struct Fold {
+        bool alongX;
+        int pos;
+    };
+
+    void setPoint(const int x, const int y) {
+        m_data[x].insert(y);
+        m_x_size = std::max(m_x_size, x);
+        m_y_size = std::max(m_y_size, y);
+    }
+
+    void print(std::ostream& os) const {
+        checkSize();
+
+        for (int y = 0; y < m_y_size; ++y) {
+            for (int x = 0; x < m_x_size; ++x) {
+                const auto it_col = m_data.find(x);
+                const bool filled = it_col != m_data.end() && it_col->second.contains(y);
+
+                if (filled)
+                    os << "#";
+                else
+                    os << " ";
+            }
+            os << "\n";
+        }
+    }
+
+    int count_visible_dots() const {
+        checkSize();
+        int count = 0;
+        for (const auto& [x, column] : m_data) {
+            count += static_cast<int>(column.size());
+        }
+        return count;
+    }
+
+    void execute_fold(const Fold& fold) {
+        checkSize();
+
+        if (fold.alongX) {
+            fold_x(fold.pos);
+        } else {
+            fold_y(fold.pos);
+        }
+    }
+
+   private:
+    std::map<int, std::set<int>> m_data;
+    int m_x_size{0};
+    int m_y_size{0};
+
+    void checkSize() const {
+        if (m_x_size == 0 || m_y_size == 0) {
+            throw std::runtime_error("Size may not be 0 for this operation");
+        }
+    }
+
+    // fold the grid part right of at_x left
+    void fold_x(const int at_x) {
+        assert(at_x > 0);
+
+        // walk through everything right of the vertical line at at_x
+        // project x-coord left and set cell there to true
+
+        const auto project_x_to_left = [at_x](const int x) -> int {
+            assert(x >= at_x);
+            const int dist = x - at_x;
+            const int new_x = at_x - dist;
+            assert(new_x >= 0);
+            return new_x;
+        };
+
+        for (const auto& [x, column] : m_data) {
+            if (x <= at_x) {
+                // should not be projected
+                continue;
+            }
+            // this column should be projected left
+            const int to_x = project_x_to_left(x);
+            for (const int y : column) {
+                m_data[to_x].insert(y);
+            }
+        }
+
+        // delete the unnecessary columns which were folded
+        m_data.erase(m_data.lower_bound(at_x), m_data.end());
+
+        m_x_size = at_x;
+    }
+
+    // fold the grid part below at_y up
+    void fold_y(const int at_y) {
+        assert(at_y > 0);
+
+        const auto project_y_up = [at_y](const int y) -> int {
+            assert(y >= at_y);
+            const int dist = y - at_y;
+            const int new_y = at_y - dist;
+            assert(new_y >= 0);
+            return new_y;
+        };
+
+        std::vector<int> empty_x_columns;
+        for (auto& [x, column] : m_data) {
+            for (const int y : column) {
+                if (y <= at_y) continue;
+
+                const int to_y = project_y_up(y);
+                m_data[x].insert(to_y);
+            }
+            column.erase(column.lower_bound(at_y), column.end());
+            if (column.size() == 0) empty_x_columns.push_back(x);
+        }
+
+        for (const int x : empty_x_columns) {
+            m_data.erase(x);
+        }
+
+        m_y_size = at_y;
+    }
+};
+
+struct Input {
+    Grid grid;
+    std::vector<Grid::Fold> folds;
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    Input input;
+    // read in lines
+    std::string_view line;
+    while (in.getline(line) && !aoc::trim(line).empty()) {
+        // read grid
+        line = aoc::trim(line);
+        const auto [x_str, y_str] = aoc::split_n<2>(line, ",");
+        const int x = aoc::to_number<int>(x_str);
+        const int y = aoc::to_number<int>(y_str);
+        input.grid.setPoint(x, y);
+    }
+
+    while (in.getline(line)) {
+        // read folds
+        line = aoc::trim(line);
+        if (line.empty()) continue;
+        aoc::FieldReader fields(line);
+        const std::string_view axis = fields.skip("fold along ").next("=");
+        const bool alongX = axis == "x";
+        const int pos = aoc::to_number<int>(fields.rest());
+        input.folds.emplace_back(Grid::Fold{.alongX = alongX, .pos = pos});
+    }
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << "Read grid and " << input.folds.size() << " folds\n";
+    os << " --- Part 1 ---\n";
+
+    Grid grid = input.grid;
+    grid.execute_fold(input.folds.at(0));
+    os << "Count of visible dots after 1 fold: " << grid.count_visible_dots() << "\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    os << " --- Part 2 ---\n";
+    Grid grid = input.grid;
+    for (const auto& fold : input.folds) {
+        grid.execute_fold(fold);
+    }
+    grid.print(os);
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day13", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day13
@@ -0,0 +1,228 @@
+#include "day14.h"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <optional>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day14 {
+
+using RawLookupType = std::unordered_map<std::string, char>;
+
+class LookupResult {
+   public:
+    std::unordered_map<char, size_t> count;  // count of chars in lookup
+
+    LookupResult& merge(const LookupResult& rhs) {
+        for (const auto& [ch, ch_count] : rhs.count) {
+            this->count[ch] += ch_count;
+        }
+        return *this;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const LookupResult& obj) {
+        for (const auto& [ch, ch_count] : obj.count) {
+            os << ch << " (" << ch_count << ") ";
+        }
+        os << "\n";
+        return os;
+    }
+
+    struct CountResult {
+        char most_common;
+        size_t most_common_count;
+        char least_common;
+        size_t least_common_count;
+    };
+
+    CountResult count_common() const {
+        assert(count.size() > 0);
+
+        char most_common{};
+        size_t most_common_count{0};
+        char least_common{};
+        size_t least_common_count{std::numeric_limits<size_t>::max()};
+        for (const auto& [ch, count] : count) {
+            if (count > most_common_count) {
+                most_common_count = count;
+                most_common = ch;
+            }
+            if (count < least_common_count) {
+                least_common_count = count;
+                least_common = ch;
+            }
+        }
+
+        return CountResult{.most_common = most_common,
+                           .most_common_count = most_common_count,
+                           .least_common = least_common,
+                           .least_common_count = least_common_count};
+    };
+
+    void print_stats(std::ostream& os) const {
+        const auto counted = count_common();
+        os << "Most common: " << counted.most_common << " (" << counted.most_common_count
+           << "), least common: " << counted.least_common << " (" << counted.least_common_count
+           << ")\n";
+        os << "Difference: " << counted.most_common_count << " - " << counted.least_common_count
+           << " = " << counted.most_common_count - counted.least_common_count << "\n";
+    };
+};
+
+LookupResult lookupPolymerByFreqCount(const std::string& polymer, const RawLookupType& subs,
+                                      const int steps) {
+    // more efficient solution than below
+    assert(polymer.size() >= 2);
+    assert(steps >= 0);
+    using std::string;
+
+    // init pair and letter count
+    std::unordered_map<std::string, size_t> freq_pairs;  // number of pairs like NN
+    std::unordered_map<char, size_t> freq_char;          // number of chars like N
+
+    ++freq_char[polymer[0]];
+    for (size_t i = 1; i < polymer.size(); ++i) {
+        ++freq_pairs[string{polymer[i - 1], polymer[i]}];
+        ++freq_char[polymer[i]];
+    }
+
+    // perform steps
+    for (int i = 0; i < steps; ++i) {
+        // create completely new count of pairs as they are replaced but only increase letter count
+        std::unordered_map<std::string, size_t> new_freq_pairs;
+
+        for (const auto& [pair, pair_count] : freq_pairs) {
+            assert(subs.find(pair) != subs.end());
+            const char ch_new = subs.find(pair)->second;
+            freq_char[ch_new] += pair_count;
+            new_freq_pairs[string{pair[0], ch_new}] += pair_count;
+            new_freq_pairs[string{ch_new, pair[1]}] += pair_count;
+        }
+        std::swap(new_freq_pairs, freq_pairs);
+    }
+
+    return LookupResult{.count = freq_char};
+}
+
+class LookupHelper {
+    // solution which uses dynamic programming + memoization
+   public:
+    LookupHelper(RawLookupType subs) : m_subs{std::move(subs)} {}
+
+    // count chars after iterating on whole string for steps
+    LookupResult count_all(const std::string& s, const int steps) {
+        assert(s.size() >= 2);
+        assert(steps >= 0);
+
+        LookupResult res{};
+        ++res.count[s[0]];
+        // count result for two-letter elements
+        for (size_t i = 1; i < s.size(); ++i) {
+            ++res.count[s[i]];
+            const std::string partial_string{s[i - 1], s[i]};
+            res.merge(count_new(partial_string, steps));
+        }
+        return res;
+    }
+
+   private:
+    RawLookupType m_subs;
+
+    std::map<std::pair<std::string, int>, LookupResult> m_cache;
+
+    // count how many characters are added by iterating on two-char string s steps times
+    LookupResult count_new(const std::string& s, const int steps) {
+        assert(s.size() == 2);
+        assert(steps >= 0);
+        assert('A' <= s[0] && s[0] <= 'Z');
+        assert('A' <= s[1] && s[1] <= 'Z');
+        assert(m_subs.find(s) != m_subs.end());
+
+        // std::cout << "Checking " << s << ", " << steps << "\n";
+
+        if (steps == 0) return LookupResult{};
+        if (steps == 1) {
+            LookupResult res{};
+            ++res.count[m_subs[s]];
+            return res;
+        }
+
+        // check cache
+        if (auto it_cache = m_cache.find(std::make_pair(s, steps)); it_cache != m_cache.end()) {
+            return it_cache->second;
+        }
+
+        // split the calculation up
+        const std::string new_left{s[0], m_subs[s]};
+        const std::string new_right{m_subs[s], s[1]};
+        LookupResult res{};
+        ++res.count[m_subs[s]];
+        res.merge(count_new(new_left, steps - 1)).merge(count_new(new_right, steps - 1));
+
+        m_cache[std::make_pair(s, steps)] = res;
+
+        return res;
+    }
+};
+
+struct Input {
+    std::string polymer;
+    RawLookupType substitutions;
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    Input input;
+    // read in lines
+    std::string_view line;
+    if (!in.getline(line)) throw std::runtime_error("Missing polymer template");
+    input.polymer = line;
+
+    while (in.getline(line)) {
+        if (line == "") continue;
+
+        const auto [pair, inserted] = aoc::split_n<2>(line, " -> ");
+        input.substitutions[string(pair)] = inserted.at(0);
+    }
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+
+    LookupHelper look(input.substitutions);
+    os << "After 10 steps:\n";
+    look.count_all(input.polymer, 10).print_stats(os);
+    os << "\nUsing frequency count:\n";
+    lookupPolymerByFreqCount(input.polymer, input.substitutions, 10).print_stats(os);
+}
+
+void part2(const Input& input, std::ostream& os) {
+    os << " --- Part 2 ---\n";
+
+    LookupHelper look(input.substitutions);
+    os << "After 40 steps:\n";
+    look.count_all(input.polymer, 40).print_stats(os);
+
+    os << "\nUsing frequency count:\n";
+    lookupPolymerByFreqCount(input.polymer, input.substitutions, 40).print_stats(os);
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day14", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day14
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <vector>
+
+#include "aoc/solution.h"
+
+namespace day15 {
+
+// Lowest total cost of a path from the upper left to the lower right cell
+int lowestCostDijkstra(const std::vector<std::vector<int>>& cost);
+
+const aoc::Solution& solution();
+
+}  // namespace day15
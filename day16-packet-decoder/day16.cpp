@@ -0,0 +1,280 @@
+#include "day16.h"
+
+#include <bits/stdc++.h>
+
+#include "aoc/line_reader.h"
+
+namespace day16 {
+
+// append binary values to binary vector
+// EXAMPLE: append(bin, 0, 0, 0, 1)
+template <typename... Args>
+void append(std::vector<bool>& bin, Args... values) {
+    auto append_lambda = [&bin](auto& append_lambda, int first, auto... rest) {
+        auto append_single = [&bin](const bool val) { bin.push_back(val); };
+
+        append_single(first == 0 ? false : true);
+        if constexpr (sizeof...(rest) > 0) {
+            append_lambda(append_lambda, rest...);
+        }
+    };
+
+    append_lambda(append_lambda, values...);
+}
+
+std::ostream& operator<<(std::ostream& os, const Packet& pk) {
+    os << "Packet[v=" << pk.version << ", type_id=" << pk.type_id << ", ";
+    pk.check();
+    if (pk.literal.has_value()) {
+        os << "literal=" << pk.literal.value();
+    } else {
+        os << "sub=[";
+        for (const auto& subpk : pk.packets) {
+            os << subpk << ", ";
+        }
+        os << "]";
+    }
+    os << "]";
+    return os;
+}
+
+std::vector<bool> hex2bin(const std::string_view hex) {
+    using std::string;
+    using std::vector;
+
+    vector<bool> bin;
+    bin.reserve(hex.size() * 4);
+
+    for (const char c : hex) {
+        switch (c) {
+            case '0':
+                append(bin, 0, 0, 0, 0);
+                break;
+            case '1':
+                append(bin, 0, 0, 0, 1);
+                break;
+            case '2':
+                append(bin, 0, 0, 1, 0);
+                break;
+            case '3':
+                append(bin, 0, 0, 1, 1);
+                break;
+            case '4':
+                append(bin, 0, 1, 0, 0);
+                break;
+            case '5':
+                append(bin, 0, 1, 0, 1);
+                break;
+            case '6':
+                append(bin, 0, 1, 1, 0);
+                break;
+            case '7':
+                append(bin, 0, 1, 1, 1);
+                break;
+            case '8':
+                append(bin, 1, 0, 0, 0);
+                break;
+            case '9':
+                append(bin, 1, 0, 0, 1);
+                break;
+            case 'A':
+                append(bin, 1, 0, 1, 0);
+                break;
+            case 'B':
+                append(bin, 1, 0, 1, 1);
+                break;
+            case 'C':
+                append(bin, 1, 1, 0, 0);
+                break;
+            case 'D':
+                append(bin, 1, 1, 0, 1);
+                break;
+            case 'E':
+                append(bin, 1, 1, 1, 0);
+                break;
+            case 'F':
+                append(bin, 1, 1, 1, 1);
+                break;
+            default:
+                throw std::invalid_argument("Unknown hex character");
+                break;
+        }
+    }
+
+    return bin;
+}
+
+template <typename T>
+[[maybe_unused]] void print(const std::vector<T>& vec, const char* const sep = "") {
+    for (const auto elem : vec) {
+        std::cout << elem << sep;
+    }
+    std::cout << "\n";
+}
+
+int parse_int(const std::vector<bool>& bin, size_t& idx, const size_t len) {
+    assert(len > 0);
+    assert(idx + len <= bin.size());
+
+    const size_t end = idx + len;
+    int val = 0;
+    for (; idx < end; ++idx) {
+        val = val * 2 + (bin[idx] ? 1 : 0);
+    }
+    return val;
+}
+
+// parse literal value of unknown length
+size_t parse_literal(const std::vector<bool>& bin, size_t& idx) {
+    size_t val = 0;
+
+    bool last_group_found = false;
+    while (!last_group_found) {
+        assert(idx + 5 <= bin.size());
+        last_group_found = bin[idx++] == 0;
+        for (int i = 0; i < 4; ++i) {
+            val = val * 2 + bin[idx++];
+        }
+    }
+    return val;
+}
+
+Packet parse_packet(const std::vector<bool>& bin, size_t& idx) {
+    Packet packet{};
+    packet.version = parse_int(bin, idx, 3);
+    packet.type_id = parse_int(bin, idx, 3);
+
+    if (packet.type_id == 4) {
+        // literal value
+        packet.literal = parse_literal(bin, idx);
+    } else {
+        // sub packets
+
+        const bool length_type = bin.at(idx++);
+        if (length_type == 0) {
+            const size_t total_length_in_bits = static_cast<size_t>(parse_int(bin, idx, 15));
+            const size_t started_at = idx;
+
+            while (idx < started_at + total_length_in_bits) {
+                packet.packets.emplace_back(parse_packet(bin, idx));
+            }
+        } else {
+            const int num_sub_packets = parse_int(bin, idx, 11);
+            for (int i = 0; i < num_sub_packets; ++i) {
+                packet.packets.emplace_back(parse_packet(bin, idx));
+            }
+        }
+    }
+
+    return packet;
+}
+
+int version_sum(const Packet& packet) {
+    int sum = packet.version;
+
+    for (const Packet& sub : packet.packets) {
+        sum += version_sum(sub);
+    }
+
+    return sum;
+}
+
+size_t evaluate(const Packet& packet) {
+    size_t result = 0;
+
+    // could also reduce
+    switch (packet.type_id) {
+        case 0: {
+            // sum
+            for (const Packet& subp : packet.packets) {
+                result += evaluate(subp);
+            }
+            break;
+        }
+        case 1: {
+            // product
+            result = 1;
+            for (const Packet& subp : packet.packets) {
+                result *= evaluate(subp);
+            }
+            break;
+        }
+        case 2: {
+            // minimum
+            result = std::numeric_limits<decltype(result)>::max();
+            for (const Packet& subp : packet.packets) {
+                result = std::min(result, evaluate(subp));
+            }
+            break;
+        }
+        case 3: {
+            // maximum
+            result = std::numeric_limits<decltype(result)>::min();
+            for (const Packet& subp : packet.packets) {
+                result = std::max(result, evaluate(subp));
+            }
+            break;
+        }
+        case 4: {
+            // literal
+            assert(packet.literal.has_value());
+            result = packet.literal.value();
+            break;
+        }
+        case 5: {
+            // greater than
+            assert(packet.packets.size() == 2);
+            result = evaluate(packet.packets[0]) > evaluate(packet.packets[1]) ? 1 : 0;
+            break;
+        }
+        case 6: {
+            // less than
+            assert(packet.packets.size() == 2);
+            result = evaluate(packet.packets[0]) < evaluate(packet.packets[1]) ? 1 : 0;
+            break;
+        }
+        case 7: {
+            // equal to
+            assert(packet.packets.size() == 2);
+            result = evaluate(packet.packets[0]) == evaluate(packet.packets[1]) ? 1 : 0;
+            break;
+        }
+        default: {
+            throw std::runtime_error("Unknown type id");
+        }
+    }
+    return result;
+}
+
+struct Input {
+    Packet top_packet;
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    std::string_view line;
+    if (!in.getline(line)) throw std::runtime_error("Missing transmission");
+    assert(!line.empty());
+    const std::vector<bool> data = hex2bin(line);
+
+    size_t i = 0;
+    return Input{.top_packet = parse_packet(data, i)};
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+    os << "Version sum: " << version_sum(input.top_packet) << "\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    os << " --- Part 2 ---\n";
+    os << "Evaluated: " << evaluate(input.top_packet) << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day16", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day16
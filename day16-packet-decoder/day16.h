@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "aoc/solution.h"
+
+namespace day16 {
+
+struct Packet {
+    int version;
+    int type_id;
+    // may only contain either literal OR packets
+    std::optional<size_t> literal;
+    std::vector<Packet> packets;
+
+    void check() const {
+        if (literal.has_value() && !packets.empty()) {
+            throw std::logic_error("Packet may not contain both a literal and sub-packets");
+        }
+    }
+};
+
+// Convert hex characters to their bits
+std::vector<bool> hex2bin(std::string_view hex);
+
+// parse packet of unknown length starting at idx, which is moved past the packet
+Packet parse_packet(const std::vector<bool>& bin, size_t& idx);
+
+// Value of the expression which the packet represents
+size_t evaluate(const Packet& packet);
+
+const aoc::Solution& solution();
+
+}  // namespace day16
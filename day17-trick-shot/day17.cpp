@@ -0,0 +1,130 @@
+#include "day17.h"
+
+#include <bits/stdc++.h>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+
+namespace day17 {
+
+// find roots of a*x^2 + b*x + c = 0
+std::pair<double, double> find_root(const int a, const int b, const int c) {
+    const int under_root = b * b - 4 * a * c;
+    if (under_root < 0) {
+        throw std::runtime_error("No real solution");
+    }
+    const double first_root = 1.0 * (-b + std::sqrt(under_root)) / 2 * a;
+    const double second_root = 1.0 * (-b - std::sqrt(under_root)) / 2 * a;
+    return {first_root, second_root};
+}
+
+struct Input {
+    std::array<int, 2> x_range;
+    std::array<int, 2> y_range;
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    Input input;
+    std::string_view line;
+    if (!in.getline(line)) throw std::runtime_error("Missing target area");
+    aoc::FieldReader fields(aoc::trim(line));
+    input.x_range[0] = fields.skip("x=").next_number<int>("..");
+    input.x_range[1] = fields.next_number<int>(", ");
+    input.y_range[0] = fields.skip("y=").next_number<int>("..");
+    input.y_range[1] = aoc::to_number<int>(fields.rest());
+
+    // some assumptons for this solution
+    assert(input.x_range[0] >= 0 && input.x_range[1] > 0);
+    assert(input.y_range[0] < 0 && input.y_range[1] <= 0);
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << "Read target: x=" << input.x_range[0] << ".." << input.x_range[1]
+       << ", y=" << input.y_range[0] << ".." << input.y_range[1] << "\n";
+    os << " --- Part 1 ---\n";
+
+    // with the given physics, a probe shot upwards with vy_start >= 0 will be at height 0 with
+    // vy_new0 = -(vy_start+1) when it falls back down
+    // the maximum height can thus be reached by shooting upward with such a velocity that the
+    // probe later reaches 0 again and then immediately falls into the lowest row of the target
+    // area
+    // x velocity need not be considered
+    assert(input.y_range[0] < 0);
+    const int best_vy = -input.y_range[0] - 1;
+    const int max_height = best_vy * (best_vy + 1) / 2;  // gaussian sum again
+    os << "Max height: " << max_height << "\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    os << " --- Part 2 ---\n";
+
+    const auto x_range = input.x_range;
+    const auto y_range = input.y_range;
+
+    // maybe there's a better way... but why not limit the possible vx and vy and then just
+    // check by simulation
+    // vx*(vx+1)/2 = final_x
+    // => vx^2 + vx - 2*final_x = 0
+
+    assert(x_range[0] > 0 && x_range[1] > 0);
+    // calculate minimum/maximum x velocity
+    const auto vx_min_cands_double = find_root(1, 1, -2 * x_range[0]);
+    const double vx_min_double =
+        vx_min_cands_double.first > 0 ? vx_min_cands_double.first : vx_min_cands_double.second;
+
+    int vx_min = std::round(vx_min_double);
+    while ((vx_min * (vx_min + 1) / 2) < x_range[0]) {
+        ++vx_min;
+    }
+
+    const int vx_max = x_range[1];
+
+    assert(y_range[0] < 0 && y_range[1] < 0);
+    const int vy_min = y_range[0];
+    const int vy_max = -y_range[0] - 1;
+
+    os << "vx_min=" << vx_min << ", vx_max=" << vx_max << "\n";
+    os << "vy_min=" << vy_min << ", vy_max=" << vy_max << "\n";
+
+    auto goes_into_target = [x_range, y_range](int vx, int vy) -> bool {
+        // whether this initial velocity leads to probe ever being in target area
+        int x = 0;
+        int y = 0;
+        while (x <= x_range[1] && y >= y_range[0]) {
+            if (x_range[0] <= x && x <= x_range[1] && y_range[0] <= y && y <= y_range[1]) {
+                return true;
+            }
+            // step
+            x += vx;
+            y += vy;
+
+            if (vx > 0)
+                vx -= 1;
+            else if (vx < 0)
+                vx += 1;
+
+            vy -= 1;
+        }
+        return false;
+    };
+
+    int count_into_target = 0;
+    for (int vx = vx_min; vx <= vx_max; ++vx) {
+        for (int vy = vy_min; vy <= vy_max; ++vy) {
+            if (goes_into_target(vx, vy)) {
+                ++count_into_target;
+            }
+        }
+    }
+    os << count_into_target << " initial velocities lead into target\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day17", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day17
@@ -0,0 +1,208 @@
+#include "day18.h"
+
+#include <bits/stdc++.h>
+
+#include "aoc/line_reader.h"
+
+namespace day18 {
+
+Number::UPtr Number::makeFromString(const std::string_view sv) {
+    assert(!sv.empty());
+    auto top_num = makeEmpty();
+
+    std::vector<Number*> stack;
+    stack.push_back(top_num.get());
+    for (size_t idx = 0; idx < sv.size(); ++idx) {
+        const auto isNum = [](const char c) -> bool { return '0' <= c && c <= '9'; };
+        if (sv[idx] == '[') {
+            // create pair
+            assert(!stack.empty());
+            Number* parent = stack.back();
+            stack.pop_back();
+            parent->pair = std::make_pair(makeEmpty(), makeEmpty());
+            stack.push_back(parent->pair.value().second.get());
+            stack.push_back(parent->pair.value().first.get());
+        } else if (isNum(sv[idx])) {
+            // parse number
+            assert(!stack.empty());
+            int val = 0;
+            do {
+                val = 10 * val + (sv[idx] - '0');
+            } while (idx + 1 < sv.size() && isNum(sv[idx + 1]) && ++idx);
+            Number* num = stack.back();
+            stack.pop_back();
+            num->regular = val;
+        } else {
+            // should be , or ] which can be skipped
+            assert(sv[idx] == ',' || sv[idx] == ']');
+        }
+    }
+    assert(stack.empty());
+
+    return top_num;
+}
+
+std::ostream& operator<<(std::ostream& os, const Number& num) {
+    if (num.regular.has_value()) {
+        os << num.regular.value();
+    } else {
+        os << "[" << *num.pair.value().first << "," << *num.pair.value().second << "]";
+    }
+    return os;
+}
+
+// Find the target number, if any, to explode and the regular numbers before and after if they exist
+// with DFS
+void findToExplode(const int depth, Number* curr, Number*& prev, Number*& target, Number*& post) {
+    assert(curr != nullptr);
+    if (post != nullptr) return;
+
+    if (curr->isRegular()) {
+        if (target == nullptr) {
+            prev = curr;
+        } else {
+            post = curr;
+        }
+    } else {
+        // pair
+        if (depth == 4 && target == nullptr) {
+            // pair inside 4 pairs and no target found yet
+            assert(curr->pair.value().first->isRegular() && curr->pair.value().second->isRegular());
+            target = curr;
+        } else {
+            // recurse
+            findToExplode(depth + 1, curr->pair.value().first.get(), prev, target, post);
+            findToExplode(depth + 1, curr->pair.value().second.get(), prev, target, post);
+        }
+    }
+}
+
+bool explodeIfNecessary(Number* top_num) {
+    Number* prev = nullptr;
+    Number* target = nullptr;
+    Number* post = nullptr;
+    findToExplode(0, top_num, prev, target, post);
+
+    if (target == nullptr) {
+        return false;
+    }
+
+    // explode
+    if (prev != nullptr) {
+        prev->regular.value() += target->pair.value().first->regular.value();
+    }
+    if (post != nullptr) {
+        post->regular.value() += target->pair.value().second->regular.value();
+    }
+    target->pair = {};
+    target->regular = 0;
+    return true;
+}
+
+// Find the target number, if any, to split
+void findToSplit(Number* curr, Number*& target) {
+    assert(curr != nullptr);
+    if (target != nullptr) return;
+
+    if (curr->isRegular()) {
+        if (curr->regular.value() >= 10) {
+            target = curr;
+        }
+    } else {
+        // pair
+        findToSplit(curr->pair.value().first.get(), target);
+        findToSplit(curr->pair.value().second.get(), target);
+    }
+}
+
+bool splitIfNecessary(Number* top_num) {
+    Number* target = nullptr;
+
+    findToSplit(top_num, target);
+
+    if (target == nullptr) {
+        return false;
+    }
+
+    // actually split
+    assert(target->isRegular());
+    const int old_val = target->regular.value();
+    target->regular = {};
+    const int val_floor = old_val / 2;
+    const int val_ceil = std::ceil(old_val / 2.0);
+    target->pair = std::make_pair(Number::makeRegular(val_floor), Number::makeRegular(val_ceil));
+    return true;
+}
+
+void reduce(Number* top_num) {
+    assert(top_num != nullptr);
+
+    // keep exploding or splitting until nothing to do
+    while (explodeIfNecessary(top_num) || splitIfNecessary(top_num)) {
+    }
+}
+
+Number::UPtr add(Number::UPtr first, Number::UPtr second) {
+    Number::UPtr top_num = std::make_unique<Number>(
+        Number{.regular = {}, .pair = std::make_pair(std::move(first), std::move(second))});
+    reduce(top_num.get());
+    return top_num;
+}
+
+struct Input {
+    std::vector<std::string> input_strings;  // for creating numbers on-demand
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    Input input;
+    std::string_view line;
+    while (in.getline(line)) {
+        input.input_strings.emplace_back(std::move(line));
+    }
+    assert(!input.input_strings.empty());
+    return input;
+}
+
+void part1(const Input& input, std::ostream& os) {
+    os << " --- Part 1 ---\n";
+
+    const auto& input_strings = input.input_strings;
+    assert(!input_strings.empty());
+
+    Number::UPtr num = Number::makeFromString(input_strings.front());
+    for (size_t i = 1; i < input_strings.size(); ++i) {
+        num = add(std::move(num), Number::makeFromString(input_strings[i]));
+    }
+
+    os << "Final sum: " << *num << "\n";
+    os << "Magnitude: " << num->magnitude() << "\n";
+}
+
+void part2(const Input& input, std::ostream& os) {
+    os << " --- Part 2 ---\n";
+
+    const auto& input_strings = input.input_strings;
+
+    // Find largest possible magnitude of addition result of any two numbers
+    int largest_magnitude = std::numeric_limits<int>::min();
+    for (size_t i = 0; i < input_strings.size(); ++i) {
+        // iterate from the start again as result is non-commutative
+        for (size_t j = 0; j < input_strings.size(); ++j) {
+            if (i == j) continue;
+            Number::UPtr num1 = Number::makeFromString(input_strings[i]);
+            Number::UPtr num2 = Number::makeFromString(input_strings[j]);
+            Number::UPtr res = add(std::move(num1), std::move(num2));
+            largest_magnitude = std::max(largest_magnitude, res->magnitude());
+        }
+    }
+    os << "Largest possible magnitude by adding two numbers: " << largest_magnitude << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day18", "input.txt", AOC_DAY_DIR, parse, part1, part2);
+    return instance;
+}
+
+}  // namespace day18
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <utility>
+
+#include "aoc/solution.h"
+
+namespace day18 {
+
+// Snailfish number
+struct Number {
+    using UPtr = std::unique_ptr<Number>;
+
+    // std::variant would be better than two optionals, but visitors are eh...
+    std::optional<int> regular;                 // if regular, the value
+    std::optional<std::pair<UPtr, UPtr>> pair;  // if non-regular, the children
+
+    bool isRegular() const { return regular.has_value(); }
+
+    int magnitude() const {
+        if (isRegular()) {
+            return regular.value();
+        }
+
+        return 3 * pair.value().first->magnitude() + 2 * pair.value().second->magnitude();
+    }
+
+    static UPtr makeRegular(const int val) {
+        return std::make_unique<Number>(Number{.regular = val, .pair = {}});
+    }
+
+    // make from pair - without reduction!
+    static UPtr makePair(UPtr first, UPtr second) {
+        return std::make_unique<Number>(
+            Number{.regular = {}, .pair = std::make_pair(std::move(first), std::move(second))});
+    }
+
+    static UPtr makeEmpty() { return std::make_unique<Number>(); }
+
+    // Parse valid snailfish number string into Number
+    static UPtr makeFromString(std::string_view sv);
+};
+
+// Explode and split until the number is reduced
+void reduce(Number* top_num);
+
+// Add two snailfish numbers and reduce
+Number::UPtr add(Number::UPtr first, Number::UPtr second);
+
+const aoc::Solution& solution();
+
+}  // namespace day18
@@ -0,0 +1,359 @@
+#include "day19.h"
+
+#include <bits/stdc++.h>
+
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+#include "aoc/trace.h"
+
+namespace day19 {
+
+std::ostream& operator<<(std::ostream& os, const Vec3& coord) {
+    os << "(" << coord[0] << "," << coord[1] << "," << coord[2] << ")";
+    return os;
+}
+
+std::ostream& operator<<(std::ostream& os, const Rot& rot) {
+    os << "(" << rot[0] << "," << rot[1] << "," << rot[2] << ")";
+    return os;
+}
+
+// Rotate a coordinate using rotation matrix
+constexpr Vec3 rotate(const Rot& rotm, const Vec3& old_coord) {
+    Vec3 new_coord{};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            new_coord[i] += rotm[i][j] * old_coord[j];
+        }
+    }
+    return new_coord;
+}
+
+constexpr Vec3 subtract(const Vec3& lhs, const Vec3& rhs) {
+    return {lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2]};
+}
+
+constexpr Vec3 add(const Vec3& lhs, const Vec3& rhs) {
+    return {lhs[0] + rhs[0], lhs[1] + rhs[1], lhs[2] + rhs[2]};
+}
+
+constexpr int abs(const Vec3& obj) {
+    return std::sqrt(obj[0] * obj[0] + obj[1] * obj[1] + obj[2] * obj[2]);
+}
+
+constexpr Vec3 negate(Vec3 obj) {
+    obj[0] *= -1;
+    obj[1] *= -1;
+    obj[2] *= -1;
+    return obj;
+}
+
+// Rotate a rotation matrix rhs using lhs
+constexpr Rot mult(const Rot& lhs, const Rot& rhs) {
+    Rot new_rotm{};
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            for (int k = 0; k < 3; ++k) {
+                new_rotm[i][j] += lhs[i][k] * rhs[k][j];
+            }
+        }
+    }
+    return new_rotm;
+}
+
+// Transpose a rotation matrix (i.e. invert it, assuming it is valid)
+constexpr Rot transpose(Rot rot) {
+    for (int row = 0; row < 3; ++row) {
+        for (int col = row + 1; col < 3; ++col) {
+            std::swap(rot[row][col], rot[col][row]);
+        }
+    }
+    return rot;
+}
+
+// For combining hashes; stolen from boost
+template <typename T>
+void hash_combine(size_t& seed, T const& v) {
+    seed ^= std::hash<T>()(v) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+}  // namespace day19
+
+namespace std {
+template <>
+struct hash<day19::Vec3> {
+    size_t operator()(const day19::Vec3& obj) const {
+        size_t seed = 0;
+        for (const auto elem : obj) {
+            day19::hash_combine(seed, elem);
+        }
+        return seed;
+    }
+};
+}  // namespace std
+
+namespace day19 {
+
+constexpr Rot ROTATION_IDENTITY = Rot{{{1, 0, 0}, {0, 1, 0}, {0, 0, 1}}};
+
+// All relevant rotation matrices
+constexpr std::array<Rot, 24> ALL_ROTATIONS = []() {
+    using std::array;
+
+    array<Rot, 24> res{};
+
+    const Rot once_around_x = Rot{{{1, 0, 0}, {0, 0, 1}, {0, -1, 0}}};
+    const Rot once_around_y = Rot{{{0, 0, -1}, {0, 1, 0}, {1, 0, 0}}};
+    const Rot once_around_z = Rot{{{0, 1, 0}, {-1, 0, 0}, {0, 0, 1}}};
+
+    int idx = 0;
+    // Strategy: bring x axis into the 6 possible directions x, z, -x, -z, y, -y
+    // then for each of these, rotate four times around (new) x axis
+    Rot rot = ROTATION_IDENTITY;  // start with identity matrix
+    for (int y = 0; y < 4; ++y) {
+        // x_new = x, z, -x, -z
+        for (int x = 0; x < 4; ++x) {
+            res[idx++] = rot;
+            rot = mult(once_around_x, rot);
+        }
+        rot = mult(once_around_y, rot);
+    }
+
+    rot = mult(once_around_z, rot);
+    // x_new = y
+    for (int x = 0; x < 4; ++x) {
+        res[idx++] = rot;
+        rot = mult(once_around_x, rot);
+    }
+    rot = mult(once_around_z, rot);
+    rot = mult(once_around_z, rot);
+    // x_new = -y
+    for (int x = 0; x < 4; ++x) {
+        res[idx++] = rot;
+        rot = mult(once_around_x, rot);
+    }
+
+    return res;
+}();
+
+BestMatchResult best_match(const std::vector<Vec3>& points1, const std::vector<Vec3>& points2) {
+    assert(!points1.empty() && !points2.empty());
+    AOC_TRACE_SCOPE("best_match");
+    AOC_TRACE_COUNT("day19 best_match calls", 1);
+    std::unordered_map<Vec3, int> count_delta;
+    for (const Vec3 a : points1) {
+        for (const Vec3& b : points2) {
+            const Vec3 delta = subtract(b, a);
+            ++count_delta[delta];
+        }
+    }
+    int max_count = -1;
+    Vec3 max_count_delta{};
+    for (const auto& [delta, count] : count_delta) {
+        if (count > max_count) {
+            max_count = count;
+            max_count_delta = delta;
+        }
+    }
+
+    return BestMatchResult{.count_matches = max_count, .delta = max_count_delta};
+}
+
+std::vector<std::vector<ScannerMatchResult>> compare_beacons(
+    const std::vector<std::vector<Vec3>>& scanner_data) {
+    using std::vector;
+
+    AOC_TRACE_SCOPE("compare_beacons");
+
+    vector<vector<ScannerMatchResult>> graph(
+        scanner_data.size(), vector<ScannerMatchResult>{});  // graph of valid match results
+
+    for (size_t i1 = 0; i1 < scanner_data.size(); ++i1) {
+        // use scanner at i1 as base
+        // rotate all detected beacons in all possible ways, then compare with other scanners
+        for (const Rot& rot : ALL_ROTATIONS) {
+            vector<Vec3> rotated_beacons;
+            rotated_beacons.reserve(scanner_data[i1].size());
+            for (const Vec3& beacon : scanner_data[i1]) {
+                rotated_beacons.emplace_back(rotate(rot, beacon));
+            }
+
+            for (size_t i2 = i1 + 1; i2 < scanner_data.size(); ++i2) {
+                const auto match_result = best_match(rotated_beacons, scanner_data[i2]);
+                if (match_result.count_matches >= 12) {
+                    graph[i1].emplace_back(ScannerMatchResult{
+                        .translation = match_result.delta, .rotation = rot, .other = i2});
+                    graph[i2].emplace_back(ScannerMatchResult{
+                        .translation = negate(rotate(transpose(rot), match_result.delta)),
+                        .rotation = transpose(rot),
+                        .other = i1});
+                }
+            }
+        }
+    }
+
+    return graph;
+}
+
+/// @return whether the match result is enough to match all scanner's data
+bool is_valid_result(const std::vector<std::vector<ScannerMatchResult>>& graph) {
+    using std::vector;
+    assert(!graph.empty());
+    vector<bool> visited(graph.size(), false);
+
+    auto dfs = [&visited, &graph](const size_t i, auto& self) {
+        assert(i < visited.size());
+        if (visited[i]) return;
+        visited[i] = true;
+        for (const auto& other_result : graph[i]) {
+            self(other_result.other, self);
+        }
+    };
+
+    dfs(0, dfs);
+
+    return std::all_of(visited.begin(), visited.end(), [](const bool b) -> bool { return b; });
+}
+
+struct Transform {
+    Vec3 translation{};  // translation from scanner 0 to this (in scanner 0 coordinates)
+    Rot rotation = ROTATION_IDENTITY;  // rotation from scanner 0 to this (in scanner 0 coordinates)
+
+    /// apply in forward direction
+    Vec3 apply(Vec3 vec) const {
+        vec = add(vec, translation);
+        vec = rotate(rotation, vec);
+        return vec;
+    }
+
+    /// apply in backward direction
+    Vec3 unapply(Vec3 vec) const {
+        vec = rotate(transpose(rotation), vec);
+        vec = subtract(vec, translation);
+        return vec;
+    }
+};
+
+/// Build tree of transformations. Uses scanner 0 as reference.
+std::vector<Transform> build_tf_tree(const std::vector<std::vector<ScannerMatchResult>>& graph) {
+    using std::vector;
+    vector<Transform> transforms(graph.size());
+
+    vector<bool> visited(graph.size(), false);
+
+    // add index of next scanner to queue when the translation from 0 to it was found
+    std::queue<size_t> queue;
+    transforms[0] = Transform{};
+    queue.emplace(0);
+
+    while (!queue.empty()) {
+        const size_t i = queue.front();
+        queue.pop();
+        if (visited[i]) continue;
+
+        visited[i] = true;
+
+        // add matches which can be reached via this match to queue
+        for (const auto& nb_match : graph[i]) {
+            Rot new_rotation = mult(nb_match.rotation, transforms[i].rotation);
+            Vec3 new_translation = add(transforms[i].translation,
+                                       rotate(transpose(new_rotation), nb_match.translation));
+
+            transforms[nb_match.other] =
+                Transform{.translation = new_translation, .rotation = new_rotation};
+            queue.emplace(nb_match.other);
+        }
+    }
+
+    return transforms;
+}
+
+// Builds the set of all beacons in S0 coordinates
+std::unordered_set<Vec3> build_beacon_map(const std::vector<Transform>& transforms,
+                                          const std::vector<std::vector<Vec3>>& scanner_data) {
+    std::unordered_set<Vec3> map;
+
+    for (size_t i = 0; i < scanner_data.size(); ++i) {
+        for (Vec3 point : scanner_data[i]) {
+            point = transforms[i].unapply(point);
+            map.insert(point);
+        }
+    }
+
+    return map;
+}
+
+int largest_manhattan_distance(const std::vector<Transform>& transforms) {
+    int max_dist = 0;
+    for (size_t i1 = 0; i1 < transforms.size(); ++i1) {
+        for (size_t i2 = i1 + 1; i2 < transforms.size(); ++i2) {
+            const Vec3 delta = subtract(transforms[i2].translation, transforms[i1].translation);
+            max_dist =
+                std::max(max_dist, std::abs(delta[0]) + std::abs(delta[1]) + std::abs(delta[2]));
+        }
+    }
+    return max_dist;
+}
+
+struct Input {
+    std::vector<std::vector<Vec3>> scanner_data;  // detected beacons by scanner, relative positions
+};
+
+// Scanner alignment is needed by both parts, so it is done once in the solve step
+struct AlignedInput {
+    std::vector<std::vector<Vec3>> scanner_data;
+    std::vector<Transform> transforms;  // from each scanner to scanner 0
+};
+
+Input parse(aoc::LineReader& in) {
+    using std::string;
+
+    Input input;
+    auto& scanner_data = input.scanner_data;
+    std::string_view line;
+    while (in.getline(line)) {
+        line = aoc::trim(line);
+        if (line.empty()) continue;
+        assert(line.at(0) == '-' && line.at(1) == '-');  // --- scanner S ---
+        scanner_data.emplace_back();
+        while (in.getline(line) && !aoc::trim(line).empty()) {
+            // beacon reading
+            const auto [x_str, y_str, z_str] = aoc::split_n<3>(aoc::trim(line), ",");
+            scanner_data.back().emplace_back(Vec3{aoc::to_number<int>(x_str),
+                                                  aoc::to_number<int>(y_str),
+                                                  aoc::to_number<int>(z_str)});
+        }
+    }
+    return input;
+}
+
+AlignedInput solve(const Input& input) {
+    const auto matches = compare_beacons(input.scanner_data);
+    if (!is_valid_result(matches)) {
+        throw std::runtime_error("Could not build transformation tree between all scanners");
+    }
+    return {input.scanner_data, build_tf_tree(matches)};
+}
+
+void part1(const AlignedInput& input, std::ostream& os) {
+    os << "Read beacons from " << input.scanner_data.size() << " scanners\n";
+    os << "Found valid match for all scanners!\n";
+    os << " --- Part 1 ---\n";
+
+    const auto beacon_map = build_beacon_map(input.transforms, input.scanner_data);
+    os << beacon_map.size() << " beacons found in finished map\n";
+}
+
+void part2(const AlignedInput& input, std::ostream& os) {
+    os << " --- Part 2 ---\n";
+
+    os << "Largest Manhattan distance: " << largest_manhattan_distance(input.transforms) << "\n";
+}
+
+const aoc::Solution& solution() {
+    static const aoc::Solution instance("day19", "input.txt", AOC_DAY_DIR, parse, solve, part1,
+                                        part2);
+    return instance;
+}
+
+}  // namespace day19
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "aoc/solution.h"
+
+namespace day19 {
+
+using Vec3 = std::array<int, 3>;                // x,y,z
+using Rot = std::array<std::array<int, 3>, 3>;  // Rotation matrix, row-first. I.e. new_x =
+                                                // rotm[0][0]*old_x + rotm[0][1]*old_y ...
+
+struct BestMatchResult {
+    int count_matches;  // how many points can be matched if delta is added to points1
+    Vec3 delta;
+};
+
+// Find the translation which matches the most points of points1 with points2
+BestMatchResult best_match(const std::vector<Vec3>& points1, const std::vector<Vec3>& points2);
+
+struct ScannerMatchResult {
+    Vec3 translation;  // delta to apply to original points
+    Rot rotation;      // rotation to apply to original points
+    size_t other;      // index of other scanner which can be sufficiently matched with this
+};
+
+// rotate and translate each scanner's beacons to match with other scanner's beacons
+/// @return adjacency list of matches with >= 12 beacons
+std::vector<std::vector<ScannerMatchResult>> compare_beacons(
+    const std::vector<std::vector<Vec3>>& scanner_data);
+
+const aoc::Solution& solution();
+
+}  // namespace day19
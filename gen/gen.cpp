@@ -0,0 +1,617 @@
+// Generate valid puzzle inputs of any size for every day.
+// The scale factor multiplies the amount of data compared to a real puzzle input (for grids: the
+// area), and the same seed always yields the same input.
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+// Deterministic random numbers - unlike the std distributions, independent of the standard library
+class Rng {
+   public:
+    explicit Rng(const uint64_t seed) : m_state{seed} {}
+
+    // splitmix64
+    uint64_t next() {
+        uint64_t z = (m_state += 0x9e3779b97f4a7c15);
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        return z ^ (z >> 31);
+    }
+
+    // uniform in [lo, hi]
+    int64_t uniform(const int64_t lo, const int64_t hi) {
+        return lo + static_cast<int64_t>(next() % static_cast<uint64_t>(hi - lo + 1));
+    }
+
+    bool chance(const double p) { return static_cast<double>(next() >> 11) * 0x1.0p-53 < p; }
+
+    template <typename T>
+    void shuffle(std::vector<T>& v) {
+        for (size_t i = v.size(); i > 1; --i) {
+            std::swap(v[i - 1], v[uniform(0, static_cast<int64_t>(i) - 1)]);
+        }
+    }
+
+   private:
+    uint64_t m_state;
+};
+
+// Number of items for a scale factor, based on the size of a real input
+size_t scaled(const double base, const double scale) {
+    return std::max<size_t>(1, static_cast<size_t>(std::llround(base * scale)));
+}
+
+// Side length of a square grid whose area grows with the scale factor
+size_t scaledSide(const double base_side, const double scale) {
+    return scaled(base_side, std::sqrt(scale));
+}
+
+void genDay01(Rng& rng, const double scale, std::ostream& os) {
+    int64_t depth = 200;
+    for (size_t i = 0; i < scaled(2000, scale); ++i) {
+        depth = std::max<int64_t>(0, depth + rng.uniform(-20, 30));
+        os << depth << "\n";
+    }
+}
+
+void genDay02(Rng& rng, const double scale, std::ostream& os) {
+    int64_t aim = 0;
+    for (size_t i = 0; i < scaled(1000, scale); ++i) {
+        const int64_t units = rng.uniform(1, 9);
+        const int64_t kind = rng.uniform(0, 2);
+        if (kind == 0) {
+            os << "forward " << units << "\n";
+        } else if (kind == 1 || aim < units) {
+            // keep the aim positive, so the submarine stays below the surface
+            os << "down " << units << "\n";
+            aim += units;
+        } else {
+            os << "up " << units << "\n";
+            aim -= units;
+        }
+    }
+}
+
+void genDay03(Rng& rng, const double scale, std::ostream& os) {
+    // readings must be unique, else the rating filters may not end with a single reading
+    const size_t count = scaled(1000, scale);
+    int bits = 12;
+    while ((uint64_t{1} << bits) < 4 * count) ++bits;
+
+    std::vector<uint64_t> readings;
+    std::unordered_set<uint64_t> seen;
+    auto add_reading = [&](const uint64_t reading) {
+        if (seen.insert(reading).second) readings.push_back(reading);
+    };
+    while (readings.size() < count) add_reading(rng.next() >> (64 - bits));
+
+    // The CO2 filter keeps the least common bit, which is undefined if all remaining readings
+    // share it. Add a reading with the other bit and check again until that never happens.
+    for (bool repaired = true; repaired;) {
+        repaired = false;
+        std::vector<uint64_t> candidates = readings;
+        for (int bit = bits - 1; bit >= 0 && candidates.size() > 1; --bit) {
+            const auto ones = static_cast<size_t>(std::count_if(
+                candidates.begin(), candidates.end(),
+                [bit](const uint64_t r) { return (r >> bit) & 1; }));
+            if (ones == 0 || ones == candidates.size()) {
+                const uint64_t prefix = ((candidates[0] >> bit) ^ 1) << bit;
+                uint64_t reading = 0;
+                do {
+                    reading = prefix | (rng.next() & ((uint64_t{1} << bit) - 1));
+                } while (seen.contains(reading));
+                add_reading(reading);
+                repaired = true;
+                break;
+            }
+            const uint64_t keep = ones * 2 < candidates.size() ? 1 : 0;
+            std::erase_if(candidates,
+                          [bit, keep](const uint64_t r) { return ((r >> bit) & 1) != keep; });
+        }
+    }
+
+    rng.shuffle(readings);
+    for (const uint64_t reading : readings) {
+        for (int bit = bits - 1; bit >= 0; --bit) os << ((reading >> bit) & 1 ? '1' : '0');
+        os << "\n";
+    }
+}
+
+void genDay04(Rng& rng, const double scale, std::ostream& os) {
+    // every number is drawn, so every board wins eventually
+    std::vector<int> numbers(100);
+    std::iota(numbers.begin(), numbers.end(), 0);
+    rng.shuffle(numbers);
+    for (size_t i = 0; i < numbers.size(); ++i) {
+        os << (i > 0 ? "," : "") << numbers[i];
+    }
+    os << "\n";
+
+    for (size_t board = 0; board < scaled(100, scale); ++board) {
+        rng.shuffle(numbers);
+        os << "\n";
+        for (int row = 0; row < 5; ++row) {
+            for (int col = 0; col < 5; ++col) {
+                const int num = numbers[row * 5 + col];
+                os << (col > 0 ? " " : "") << (num < 10 ? " " : "") << num;
+            }
+            os << "\n";
+        }
+    }
+}
+
+void genDay05(Rng& rng, const double scale, std::ostream& os) {
+    const int64_t size = scaledSide(1000, scale);
+    for (size_t i = 0; i < scaled(500, scale); ++i) {
+        const int64_t x1 = rng.uniform(0, size - 1);
+        const int64_t y1 = rng.uniform(0, size - 1);
+        const int64_t kind = rng.uniform(0, 2);
+        int64_t x2 = x1;
+        int64_t y2 = y1;
+        if (kind == 0) {
+            x2 = rng.uniform(0, size - 1);
+        } else if (kind == 1) {
+            y2 = rng.uniform(0, size - 1);
+        } else {
+            // diagonal at exactly 45 degrees which stays inside the grid
+            const int64_t dx = rng.chance(0.5) ? 1 : -1;
+            const int64_t dy = rng.chance(0.5) ? 1 : -1;
+            const int64_t max_len =
+                std::min(dx > 0 ? size - 1 - x1 : x1, dy > 0 ? size - 1 - y1 : y1);
+            const int64_t len = rng.uniform(0, max_len);
+            x2 = x1 + dx * len;
+            y2 = y1 + dy * len;
+        }
+        os << x1 << "," << y1 << " -> " << x2 << "," << y2 << "\n";
+    }
+}
+
+void genDay06(Rng& rng, const double scale, std::ostream& os) {
+    for (size_t i = 0; i < scaled(300, scale); ++i) {
+        os << (i > 0 ? "," : "") << rng.uniform(1, 5);
+    }
+    os << "\n";
+}
+
+void genDay07(Rng& rng, const double scale, std::ostream& os) {
+    for (size_t i = 0; i < scaled(1000, scale); ++i) {
+        // crabs cluster at low positions, like in the real inputs
+        const int64_t pos = rng.uniform(0, 1999) * rng.uniform(0, 1999) / 2000;
+        os << (i > 0 ? "," : "") << pos;
+    }
+    os << "\n";
+}
+
+void genDay08(Rng& rng, const double scale, std::ostream& os) {
+    // segments of each digit, using the standard wiring a-g
+    const std::array<std::string, 10> digit_segments = {
+        "abcefg", "cf", "acdeg", "acdfg", "bcdf", "abdfg", "abdefg", "acf", "abcdefg", "abcdfg"};
+
+    for (size_t i = 0; i < scaled(200, scale); ++i) {
+        std::vector<char> wiring = {'a', 'b', 'c', 'd', 'e', 'f', 'g'};
+        rng.shuffle(wiring);
+        auto scrambled = [&](const int digit) {
+            std::vector<char> segments;
+            for (const char c : digit_segments[digit]) segments.push_back(wiring[c - 'a']);
+            rng.shuffle(segments);
+            return std::string(segments.begin(), segments.end());
+        };
+
+        std::vector<int> digits(10);
+        std::iota(digits.begin(), digits.end(), 0);
+        rng.shuffle(digits);
+        for (const int digit : digits) os << scrambled(digit) << " ";
+        os << "|";
+        for (int output = 0; output < 4; ++output) os << " " << scrambled(rng.uniform(0, 9));
+        os << "\n";
+    }
+}
+
+void genDay09(Rng& rng, const double scale, std::ostream& os) {
+    // smooth random heights with ridges of 9s between the basins
+    const size_t side = scaledSide(100, scale);
+    for (size_t row = 0; row < side; ++row) {
+        for (size_t col = 0; col < side; ++col) {
+            const bool ridge = row % 7 == 3 || col % 9 == 4;
+            os << (ridge && rng.chance(0.9) ? 9 : rng.uniform(0, 8));
+        }
+        os << "\n";
+    }
+}
+
+void genDay10(Rng& rng, const double scale, std::ostream& os) {
+    const std::string opening = "([{<";
+    const std::string closing = ")]}>";
+
+    const size_t count = scaled(100, scale) | 1;  // odd number of incomplete lines for the median
+    for (size_t i = 0; i < count * 2; ++i) {
+        const bool corrupted = i % 2 == 1;
+        std::string line;
+        std::string open_stack;
+        const size_t length = rng.uniform(60, 110);
+        while (line.size() < length) {
+            // close while keeping the completion short enough for its score to fit into 64 bits
+            const bool close = !open_stack.empty() && (open_stack.size() >= 20 || rng.chance(0.45));
+            if (close) {
+                line.push_back(closing[opening.find(open_stack.back())]);
+                open_stack.pop_back();
+            } else {
+                open_stack.push_back(opening[rng.uniform(0, 3)]);
+                line.push_back(open_stack.back());
+            }
+        }
+        if (open_stack.empty()) {
+            open_stack.push_back(opening[rng.uniform(0, 3)]);
+            line.push_back(open_stack.back());
+        }
+        if (corrupted) {
+            // close with a wrong character
+            const size_t expected = opening.find(open_stack.back());
+            line.push_back(closing[(expected + rng.uniform(1, 3)) % 4]);
+        }
+        os << line << "\n";
+    }
+}
+
+void genDay11(Rng& rng, const double scale, std::ostream& os) {
+    const size_t side = scaledSide(10, scale);
+    for (size_t row = 0; row < side; ++row) {
+        for (size_t col = 0; col < side; ++col) os << rng.uniform(0, 9);
+        os << "\n";
+    }
+}
+
+void genDay12(Rng& rng, const double scale, std::ostream& os) {
+    // The number of paths grows exponentially with the caves, so only add caves logarithmically.
+    // Big caves are never connected to each other, else there would be infinitely many paths.
+    const size_t extra = static_cast<size_t>(std::max(0.0, std::log2(scale) / 2));
+    std::vector<std::string> small;
+    std::vector<std::string> big;
+    for (size_t i = 0; i < 6 + extra; ++i) {
+        small.push_back(std::string(2, static_cast<char>('a' + i)));
+    }
+    for (size_t i = 0; i < 2 + extra / 4; ++i) {
+        big.push_back(std::string(2, static_cast<char>('A' + i)));
+    }
+
+    std::set<std::pair<std::string, std::string>> edges;
+    auto connect = [&](const std::string& a, const std::string& b) {
+        if (a != b && !edges.contains({b, a})) edges.insert({a, b});
+    };
+    std::vector<std::string> caves = small;
+    caves.insert(caves.end(), big.begin(), big.end());
+    for (const std::string& b : big) {
+        for (const std::string& s : small) {
+            if (rng.chance(0.5)) connect(b, s);
+        }
+        connect(b, small[rng.uniform(0, small.size() - 1)]);
+    }
+    for (size_t i = 0; i + 1 < small.size(); ++i) {
+        connect(small[i], small[i + 1]);  // keeps all caves connected
+        if (rng.chance(0.3)) connect(small[i], small[rng.uniform(0, small.size() - 1)]);
+    }
+    for (int i = 0; i < 2; ++i) {
+        connect("start", caves[rng.uniform(0, caves.size() - 1)]);
+        connect(caves[rng.uniform(0, caves.size() - 1)], "end");
+    }
+
+    std::vector<std::pair<std::string, std::string>> shuffled(edges.begin(), edges.end());
+    rng.shuffle(shuffled);
+    for (const auto& [a, b] : shuffled) os << a << "-" << b << "\n";
+}
+
+void genDay13(Rng& rng, const double scale, std::ostream& os) {
+    // fold positions from the final 40x6 code area outward, like the real inputs
+    std::vector<std::pair<char, int64_t>> folds;
+    int64_t width = 40;
+    int64_t height = 6;
+    std::vector<int64_t> x_folds;
+    std::vector<int64_t> y_folds;
+    const size_t extra = static_cast<size_t>(std::max(0.0, std::log2(scale) / 2));
+    for (size_t i = 0; i < 5 + extra; ++i) {
+        x_folds.push_back(width);
+        width = 2 * width + 1;
+    }
+    for (size_t i = 0; i < 7 + extra; ++i) {
+        y_folds.push_back(height);
+        height = 2 * height + 1;
+    }
+    // outermost fold first, alternating between x and y while both are left
+    while (!x_folds.empty() || !y_folds.empty()) {
+        if (!x_folds.empty()) {
+            folds.emplace_back('x', x_folds.back());
+            x_folds.pop_back();
+        }
+        if (!y_folds.empty()) {
+            folds.emplace_back('y', y_folds.back());
+            y_folds.pop_back();
+        }
+    }
+
+    // random code of eight 4x6 glyphs with a blank column after each
+    std::vector<std::pair<int64_t, int64_t>> code;
+    for (int64_t x = 0; x < 40; ++x) {
+        for (int64_t y = 0; y < 6; ++y) {
+            if (x % 5 != 4 && rng.chance(0.5)) code.emplace_back(x, y);
+        }
+    }
+
+    // Every dot is a point of the code, unfolded by mirroring at random folds. Unfolded points
+    // are never on a fold line.
+    const size_t count = std::min<size_t>(
+        scaled(900, scale), code.size() * (size_t{1} << std::min<size_t>(folds.size(), 20)) / 2);
+    std::set<std::pair<int64_t, int64_t>> dots;
+    while (dots.size() < count) {
+        auto [x, y] = code[rng.uniform(0, code.size() - 1)];
+        for (auto it = folds.rbegin(); it != folds.rend(); ++it) {
+            int64_t& coord = it->first == 'x' ? x : y;
+            if (rng.chance(0.5)) coord = 2 * it->second - coord;
+        }
+        if (dots.insert({x, y}).second) os << x << "," << y << "\n";
+    }
+    os << "\n";
+    for (const auto& [axis, pos] : folds) os << "fold along " << axis << "=" << pos << "\n";
+}
+
+void genDay14(Rng& rng, const double scale, std::ostream& os) {
+    const std::string elements = "BCFHKNOPSV";
+    for (size_t i = 0; i < scaled(20, scale); ++i) os << elements[rng.uniform(0, 9)];
+    os << "\n\n";
+    // a rule for every pair, so every step can be applied
+    for (const char a : elements) {
+        for (const char b : elements) {
+            os << a << b << " -> " << elements[rng.uniform(0, 9)] << "\n";
+        }
+    }
+}
+
+void genDay15(Rng& rng, const double scale, std::ostream& os) {
+    const size_t side = scaledSide(100, scale);
+    for (size_t row = 0; row < side; ++row) {
+        for (size_t col = 0; col < side; ++col) {
+            os << (rng.chance(0.6) ? rng.uniform(1, 3) : rng.uniform(1, 9));
+        }
+        os << "\n";
+    }
+}
+
+void genDay16(Rng& rng, const double scale, std::ostream& os) {
+    std::vector<bool> bits;
+    auto append = [&bits](const uint64_t value, const int num_bits) {
+        for (int bit = num_bits - 1; bit >= 0; --bit) bits.push_back((value >> bit) & 1);
+    };
+
+    // Encode a random packet with about `budget` packets in total.
+    // Comparison operators always get exactly two sub-packets.
+    std::function<void(size_t, int)> packet = [&](size_t budget, const int depth) {
+        const int version = rng.uniform(0, 7);
+        const bool literal = budget <= 1 || depth > 40;
+        const int type_id = literal ? 4 : (rng.chance(0.2) ? rng.uniform(5, 7) : rng.uniform(0, 3));
+        append(version, 3);
+        append(type_id, 3);
+        if (literal) {
+            // value of 1 to 4 groups, so products of a few values fit into 64 bits
+            const int groups = rng.uniform(1, 4);
+            for (int group = 0; group < groups; ++group) {
+                append(group + 1 < groups ? 1 : 0, 1);
+                append(rng.uniform(group == 0 ? 1 : 0, 15), 4);
+            }
+            return;
+        }
+
+        --budget;
+        const size_t num_subs =
+            type_id >= 5 ? 2 : std::min<size_t>(budget, rng.uniform(1, 2047 < budget ? 50 : 5));
+        std::vector<bool> outer;
+        std::swap(outer, bits);
+        for (size_t i = 0; i < num_subs; ++i) {
+            packet(std::max<size_t>(1, budget / num_subs), depth + 1);
+        }
+        std::vector<bool> subs;
+        std::swap(subs, bits);
+        std::swap(bits, outer);
+
+        if (subs.size() < (1 << 15) && rng.chance(0.5)) {
+            append(0, 1);
+            append(subs.size(), 15);
+        } else {
+            append(1, 1);
+            append(num_subs, 11);
+        }
+        bits.insert(bits.end(), subs.begin(), subs.end());
+    };
+    packet(scaled(250, scale), 0);
+
+    while (bits.size() % 4 != 0) bits.push_back(false);
+    const char* hex = "0123456789ABCDEF";
+    for (size_t i = 0; i < bits.size(); i += 4) {
+        os << hex[bits[i] * 8 + bits[i + 1] * 4 + bits[i + 2] * 2 + bits[i + 3]];
+    }
+    os << "\n";
+}
+
+void genDay17(Rng& rng, const double scale, std::ostream& os) {
+    const int64_t factor = std::max<int64_t>(1, std::llround(std::sqrt(scale)));
+    const int64_t x1 = rng.uniform(150, 250) * factor;
+    const int64_t x2 = x1 + rng.uniform(10, 40) * factor;
+    const int64_t y1 = -rng.uniform(80, 150) * factor;
+    const int64_t y2 = y1 + rng.uniform(10, 50) * factor;
+    os << "target area: x=" << x1 << ".." << x2 << ", y=" << y1 << ".." << y2 << "\n";
+}
+
+void genDay18(Rng& rng, const double scale, std::ostream& os) {
+    // already reduced numbers: nested at most 4 deep, regular numbers below 10
+    std::function<void(int)> number = [&](const int depth) {
+        if (depth > 0 && (depth == 4 || rng.chance(0.35))) {
+            os << rng.uniform(0, 9);
+            return;
+        }
+        os << "[";
+        number(depth + 1);
+        os << ",";
+        number(depth + 1);
+        os << "]";
+    };
+    for (size_t i = 0; i < scaled(100, scale); ++i) {
+        number(0);
+        os << "\n";
+    }
+}
+
+void genDay19(Rng& rng, const double scale, std::ostream& os) {
+    using Vec3 = std::array<int64_t, 3>;
+
+    // all 24 rotations: signed permutation matrices with determinant 1
+    std::vector<std::array<Vec3, 3>> rotations;
+    std::array<int, 3> perm = {0, 1, 2};
+    do {
+        for (int signs = 0; signs < 8; ++signs) {
+            std::array<Vec3, 3> rot{};
+            for (int row = 0; row < 3; ++row) rot[row][perm[row]] = (signs >> row) & 1 ? -1 : 1;
+            const int64_t det = rot[0][0] * (rot[1][1] * rot[2][2] - rot[1][2] * rot[2][1]) -
+                                rot[0][1] * (rot[1][0] * rot[2][2] - rot[1][2] * rot[2][0]) +
+                                rot[0][2] * (rot[1][0] * rot[2][1] - rot[1][1] * rot[2][0]);
+            if (det == 1) rotations.push_back(rot);
+        }
+    } while (std::next_permutation(perm.begin(), perm.end()));
+
+    const int64_t range = 1000;
+    auto random_in_box = [&rng](const Vec3& lo, const Vec3& hi) {
+        return Vec3{rng.uniform(lo[0], hi[0]), rng.uniform(lo[1], hi[1]),
+                    rng.uniform(lo[2], hi[2])};
+    };
+
+    // Scanners on a random walk, each overlapping the previous one. Every overlap gets at least
+    // 12 beacons, so all scanners can be aligned.
+    const size_t num_scanners = scaled(30, scale);
+    std::vector<Vec3> scanners = {Vec3{0, 0, 0}};
+    std::set<Vec3> beacons;
+    for (size_t i = 0; i < num_scanners; ++i) {
+        const Vec3& pos = scanners.back();
+        for (int j = 0; j < 14; ++j) {
+            beacons.insert(random_in_box({pos[0] - range, pos[1] - range, pos[2] - range},
+                                         {pos[0] + range, pos[1] + range, pos[2] + range}));
+        }
+        if (i + 1 == num_scanners) break;
+
+        Vec3 next{};
+        Vec3 lo{};
+        Vec3 hi{};
+        for (int axis = 0; axis < 3; ++axis) {
+            next[axis] = pos[axis] + rng.uniform(-1200, 1200);
+            lo[axis] = std::max(pos[axis], next[axis]) - range;
+            hi[axis] = std::min(pos[axis], next[axis]) + range;
+        }
+        for (int j = 0; j < 12; ++j) beacons.insert(random_in_box(lo, hi));
+        scanners.push_back(next);
+    }
+
+    for (size_t i = 0; i < scanners.size(); ++i) {
+        const auto& rot = rotations[i == 0 ? 0 : rng.uniform(0, rotations.size() - 1)];
+        std::vector<Vec3> seen;
+        for (const Vec3& beacon : beacons) {
+            Vec3 rel{};
+            bool visible = true;
+            for (int axis = 0; axis < 3; ++axis) {
+                rel[axis] = beacon[axis] - scanners[i][axis];
+                visible = visible && std::abs(rel[axis]) <= range;
+            }
+            if (!visible) continue;
+            Vec3 rotated{};
+            for (int row = 0; row < 3; ++row) {
+                for (int col = 0; col < 3; ++col) rotated[row] += rot[row][col] * rel[col];
+            }
+            seen.push_back(rotated);
+        }
+        rng.shuffle(seen);
+
+        os << (i > 0 ? "\n" : "") << "--- scanner " << i << " ---\n";
+        for (const Vec3& b : seen) os << b[0] << "," << b[1] << "," << b[2] << "\n";
+    }
+}
+
+using Generator = void (*)(Rng&, double, std::ostream&);
+
+const std::map<std::string, Generator> GENERATORS = {
+    {"day01", genDay01}, {"day02", genDay02}, {"day03", genDay03}, {"day04", genDay04},
+    {"day05", genDay05}, {"day06", genDay06}, {"day07", genDay07}, {"day08", genDay08},
+    {"day09", genDay09}, {"day10", genDay10}, {"day11", genDay11}, {"day12", genDay12},
+    {"day13", genDay13}, {"day14", genDay14}, {"day15", genDay15}, {"day16", genDay16},
+    {"day17", genDay17}, {"day18", genDay18}, {"day19", genDay19},
+};
+
+void generate(const std::string& day, Generator gen, const uint64_t seed, const double scale,
+              std::ostream& os) {
+    // each day gets its own stream of random numbers, so it doesn't depend on the other days
+    Rng rng(seed ^ std::hash<std::string>{}(day));
+    gen(rng, scale, os);
+}
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0 << " DAY|all [--scale S] [--seed N] [--out DIR]\n"
+              << "Writes dayNN.txt into DIR, or a single day to stdout if DIR is not given\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    const std::string which = argv[1];
+    double scale = 1.0;
+    uint64_t seed = 2021;
+    std::string out_dir;
+    try {
+        for (int i = 2; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--scale" && i + 1 < argc) {
+                scale = std::stod(argv[++i]);
+            } else if (arg == "--seed" && i + 1 < argc) {
+                seed = std::stoull(argv[++i]);
+            } else if (arg == "--out" && i + 1 < argc) {
+                out_dir = argv[++i];
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+    } catch (const std::logic_error&) {
+        // std::invalid_argument or std::out_of_range of a number which doesn't parse
+        usage(argv[0]);
+        return 1;
+    }
+    if (scale <= 0 || (which == "all" && out_dir.empty()) ||
+        (which != "all" && !GENERATORS.contains(which))) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    for (const auto& [day, gen] : GENERATORS) {
+        if (which != "all" && which != day) continue;
+        if (out_dir.empty()) {
+            generate(day, gen, seed, scale, std::cout);
+            continue;
+        }
+        std::filesystem::create_directories(out_dir);
+        const auto path = std::filesystem::path(out_dir) / (day + ".txt");
+        std::ofstream ofs(path);
+        if (!ofs) throw std::runtime_error("Cannot open " + path.string());
+        generate(day, gen, seed, scale, ofs);
+    }
+}
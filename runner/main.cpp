@@ -0,0 +1,407 @@
+// Run all days in one process and report how long each phase took.
+// The days are scheduled as tasks on a work-stealing pool: parsing a day is one task, which then
+// spawns part 1 and part 2 as two independent tasks on the parsed input. Parts which split their
+// own work get a second pool of the same size: a thread waiting for such work runs pending tasks
+// of the pool meanwhile, and on the day pool these could be whole phases of other days, which
+// would then count into the time of the waiting part.
+// The median timings of several runs can be saved as a baseline, which later runs are compared
+// against to catch performance regressions.
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "aoc/alloc_stats.h"
+#include "aoc/line_reader.h"
+#include "aoc/split.h"
+#include "aoc/thread_pool.h"
+#include "aoc/trace.h"
+#include "day01.h"
+#include "day02.h"
+#include "day03.h"
+#include "day04.h"
+#include "day05.h"
+#include "day06.h"
+#include "day07.h"
+#include "day08.h"
+#include "day09.h"
+#include "day10.h"
+#include "day11.h"
+#include "day12.h"
+#include "day13.h"
+#include "day14.h"
+#include "day15.h"
+#include "day16.h"
+#include "day17.h"
+#include "day18.h"
+#include "day19.h"
+
+namespace {
+
+const std::vector<std::reference_wrapper<const aoc::Solution>> SOLUTIONS = {
+    day01::solution(), day02::solution(), day03::solution(), day04::solution(),
+    day05::solution(), day06::solution(), day07::solution(), day08::solution(),
+    day09::solution(), day10::solution(), day11::solution(), day12::solution(),
+    day13::solution(), day14::solution(), day15::solution(), day16::solution(),
+    day17::solution(), day18::solution(), day19::solution(),
+};
+
+// When and on which thread a task ran, and what it allocated
+struct TaskRecord {
+    aoc::Clock::time_point start;
+    aoc::Clock::time_point end;
+    size_t thread{};
+    aoc::AllocStats allocs;
+
+    aoc::Clock::duration duration() const { return end - start; }
+};
+
+// The solve phase runs right after parsing in the same task, and takes no time for days without
+// a solve step
+enum Phase { PARSE, SOLVE, PART1, PART2 };
+
+constexpr std::array<Phase, 4> PHASES = {PARSE, SOLVE, PART1, PART2};
+constexpr std::array<const char*, 4> PHASE_NAMES = {"parse", "solve", "part1", "part2"};
+
+struct DayRun {
+    const aoc::Solution* solution{};
+    std::array<TaskRecord, 4> tasks;  // by Phase
+    std::ostringstream part1_out;
+    std::ostringstream part2_out;
+
+    aoc::Clock::duration wall() const {
+        return std::max(tasks[PART1].end, tasks[PART2].end) - tasks[PARSE].start;
+    }
+    // time of this day if it had all threads to itself
+    aoc::Clock::duration criticalPath() const {
+        return tasks[PARSE].duration() + tasks[SOLVE].duration() +
+               std::max(tasks[PART1].duration(), tasks[PART2].duration());
+    }
+};
+
+template <typename F>
+void recordTask(const aoc::ThreadPool& pool, TaskRecord& record, F&& f) {
+    record.thread = pool.currentWorker();
+    const aoc::AllocScope alloc_scope;
+    record.start = aoc::Clock::now();
+    f();
+    record.end = aoc::Clock::now();
+    record.allocs = alloc_scope.stats();
+}
+
+double toMs(const aoc::Clock::duration d) {
+    return std::chrono::duration<double, std::milli>(d).count();
+}
+
+// Solve all days once, recording the outputs and timings into runs. Returns the batch wall time.
+aoc::Clock::duration runBatch(aoc::ThreadPool& pool, aoc::ThreadPool& part_pool,
+                              std::vector<DayRun>& runs) {
+    runs = std::vector<DayRun>(SOLUTIONS.size());
+
+    const auto batch_start = aoc::Clock::now();
+    aoc::TaskGroup group(pool);
+    for (size_t i = 0; i < SOLUTIONS.size(); ++i) {
+        DayRun& run = runs[i];
+        run.solution = &SOLUTIONS[i].get();
+
+        group.run([&pool, &part_pool, &group, &run]() {
+            const aoc::Solution& solution = *run.solution;
+            aoc::Solution::ParsedInput input;
+            recordTask(pool, run.tasks[PARSE], [&]() {
+                const std::string path = solution.sourceDir() + "/" + solution.inputFile();
+                aoc::LineReader in(path);
+                input = solution.parse(in);
+            });
+            recordTask(pool, run.tasks[SOLVE], [&]() { input = solution.solve(input); });
+
+            group.run([&pool, &part_pool, &run, input]() {
+                recordTask(pool, run.tasks[PART1],
+                           [&]() { run.solution->part1(input, run.part1_out, part_pool); });
+            });
+            group.run([&pool, &part_pool, &run, input]() {
+                recordTask(pool, run.tasks[PART2],
+                           [&]() { run.solution->part2(input, run.part2_out, part_pool); });
+            });
+        });
+    }
+    group.wait();
+    return aoc::Clock::now() - batch_start;
+}
+
+// Median timings of one day over all batches, in ms
+struct DayTimes {
+    std::string name;
+    double wall{};
+    std::array<double, 4> phases{};  // by Phase
+};
+
+double median(std::vector<double> values) {
+    auto it_mid = values.begin() + values.size() / 2;
+    std::nth_element(values.begin(), it_mid, values.end());
+    return *it_mid;
+}
+
+std::vector<DayTimes> medianTimes(const std::vector<std::vector<DayRun>>& batches) {
+    std::vector<DayTimes> times;
+    for (size_t day = 0; day < SOLUTIONS.size(); ++day) {
+        auto day_median = [&batches, day](auto&& get_ms) {
+            std::vector<double> values;
+            for (const auto& runs : batches) values.push_back(get_ms(runs[day]));
+            return median(std::move(values));
+        };
+        DayTimes& day_times = times.emplace_back();
+        day_times.name = SOLUTIONS[day].get().name();
+        day_times.wall = day_median([](const DayRun& run) { return toMs(run.wall()); });
+        for (const Phase phase : PHASES) {
+            day_times.phases[phase] = day_median(
+                [phase](const DayRun& run) { return toMs(run.tasks[phase].duration()); });
+        }
+    }
+    return times;
+}
+
+// Median ms of each (day, phase)
+using Baseline = std::map<std::pair<std::string, std::string>, double>;
+
+// One "DAY PHASE MS" line per phase
+void saveBaseline(const std::string& path, const std::vector<DayTimes>& times) {
+    std::ofstream ofs(path);
+    if (!ofs) throw std::runtime_error("Cannot open " + path);
+    ofs << std::fixed << std::setprecision(4);
+    for (const DayTimes& day : times) {
+        for (const Phase phase : PHASES) {
+            ofs << day.name << " " << PHASE_NAMES[phase] << " " << day.phases[phase] << "\n";
+        }
+    }
+}
+
+Baseline loadBaseline(const std::string& path) {
+    std::ifstream ifs(path);
+    if (!ifs) throw std::runtime_error("Cannot open " + path);
+    Baseline baseline;
+    std::string day;
+    std::string phase;
+    double ms{};
+    while (ifs >> day >> phase >> ms) baseline[{day, phase}] = ms;
+    if (!ifs.eof()) throw std::runtime_error("Invalid baseline " + path);
+    return baseline;
+}
+
+// A phase regressed if it is slower than the baseline by more than threshold_percent and by more
+// than min_ms, so that the noise of very short phases is ignored. A phase of the baseline which
+// was not run fails the comparison as well.
+/// @return whether no phase regressed or is missing
+bool compareBaseline(const Baseline& baseline, const std::vector<DayTimes>& times,
+                     const double threshold_percent, const double min_ms) {
+    std::cout << "\nComparison with baseline (threshold " << threshold_percent << " %, at least "
+              << min_ms << " ms):\n";
+    std::cout << std::left << std::setw(8) << "day" << std::setw(8) << "phase" << std::right
+              << std::setw(12) << "base ms" << std::setw(12) << "now ms" << std::setw(10)
+              << "change\n";
+
+    bool ok = true;
+    std::set<Baseline::key_type> compared;
+    for (const DayTimes& day : times) {
+        for (const Phase phase : PHASES) {
+            const double now = day.phases[phase];
+            std::cout << std::left << std::setw(8) << day.name << std::setw(8) << PHASE_NAMES[phase]
+                      << std::right << std::setw(12);
+            const auto it = baseline.find({day.name, PHASE_NAMES[phase]});
+            if (it == baseline.end()) {
+                std::cout << "-" << std::setw(12) << now << "  not in baseline\n";
+                continue;
+            }
+            compared.insert(it->first);
+            const double base = it->second;
+            const double change_percent = base > 0 ? 100.0 * (now - base) / base : 0.0;
+            const bool regressed = change_percent > threshold_percent && now - base > min_ms;
+            ok = ok && !regressed;
+            std::cout << base << std::setw(12) << now << std::setw(8) << std::setprecision(1)
+                      << std::showpos << change_percent << std::noshowpos << " %"
+                      << std::setprecision(3) << (regressed ? "  REGRESSION" : "") << "\n";
+        }
+    }
+    for (const auto& [key, base] : baseline) {
+        if (compared.contains(key)) continue;
+        ok = false;
+        std::cout << std::left << std::setw(8) << key.first << std::setw(8) << key.second
+                  << std::right << std::setw(12) << base << std::setw(12) << "-"
+                  << "  MISSING\n";
+    }
+    std::cout << (ok ? "No regressions\n" : "Performance regressed or missing\n");
+    return ok;
+}
+
+// The total wall time is the one of the whole batch, as the days overlap on several threads
+void printTable(const std::vector<DayTimes>& times, const double batch_wall_ms) {
+    auto row = [](const std::string& name, const double wall, const std::array<double, 4>& phases) {
+        std::cout << std::left << std::setw(8) << name << std::right << std::fixed
+                  << std::setprecision(3) << std::setw(12) << wall;
+        for (const double ms : phases) std::cout << std::setw(12) << ms;
+        std::cout << "\n";
+    };
+
+    std::cout << std::left << std::setw(8) << "day" << std::right << std::setw(12) << "wall ms";
+    for (const char* phase : PHASE_NAMES) std::cout << std::setw(12) << phase + std::string(" ms");
+    std::cout << "\n";
+
+    std::array<double, 4> total{};
+    for (const DayTimes& day : times) {
+        row(day.name, day.wall, day.phases);
+        for (const Phase phase : PHASES) {
+            total[phase] += day.phases[phase];
+        }
+    }
+    row("total", batch_wall_ms, total);
+}
+
+void printAllocTable(const std::vector<DayRun>& runs) {
+    std::cout << "\nAllocations (count, KiB allocated, KiB peak live):\n";
+    std::cout << std::left << std::setw(8) << "day" << std::right;
+    for (const char* phase : PHASE_NAMES) {
+        std::cout << std::setw(10) << phase << std::setw(10) << "KiB" << std::setw(10) << "peak";
+    }
+    std::cout << "\n";
+
+    for (const DayRun& run : runs) {
+        std::cout << std::left << std::setw(8) << run.solution->name() << std::right
+                  << std::setprecision(1);
+        for (const TaskRecord& task : run.tasks) {
+            std::cout << std::setw(10) << task.allocs.count << std::setw(10)
+                      << task.allocs.bytes / 1024.0 << std::setw(10)
+                      << task.allocs.peak_live / 1024.0;
+        }
+        std::cout << "\n" << std::setprecision(3);
+    }
+}
+
+void printSchedule(const std::vector<DayRun>& runs, const size_t num_threads,
+                   const aoc::Clock::duration batch_wall) {
+    const DayRun& critical = *std::max_element(
+        runs.begin(), runs.end(),
+        [](const DayRun& lhs, const DayRun& rhs) { return lhs.criticalPath() < rhs.criticalPath(); });
+
+    std::cout << "\nBatch wall time: " << toMs(batch_wall) << " ms on " << num_threads
+              << " thread(s)\n";
+    std::cout << "Critical path: " << toMs(critical.criticalPath()) << " ms ("
+              << critical.solution->name() << ": parse + solve + slower part)\n";
+
+    // the main thread runs tasks as the last "worker" of the pool
+    std::vector<aoc::Clock::duration> busy(num_threads);
+    for (const DayRun& run : runs) {
+        for (const TaskRecord& task : run.tasks) {
+            busy[task.thread] += task.duration();
+        }
+    }
+    std::cout << "Utilisation:\n";
+    for (size_t thread = 0; thread < num_threads; ++thread) {
+        const std::string name =
+            thread + 1 == num_threads ? "main" : "worker " + std::to_string(thread);
+        std::cout << "  " << std::left << std::setw(10) << name << std::right << std::setw(12)
+                  << toMs(busy[thread]) << " ms busy" << std::setw(8) << std::setprecision(1)
+                  << 100.0 * toMs(busy[thread]) / toMs(batch_wall) << " %\n"
+                  << std::setprecision(3);
+    }
+}
+
+void usage(const char* argv0) {
+    std::cerr << "Usage: " << argv0
+              << " [-j THREADS] [--trace FILE] [--reps N] [--save-baseline FILE]\n"
+                 "       [--baseline FILE [--threshold PERCENT] [--min-ms MS]]\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    size_t num_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::optional<std::string> trace_path;
+    int reps = 1;
+    std::optional<std::string> save_baseline_path;
+    std::optional<std::string> baseline_path;
+    double threshold_percent = 10.0;
+    double min_ms = 0.5;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "-j" && i + 1 < argc) {
+                num_threads = std::max(1, aoc::to_number<int>(argv[++i]));
+            } else if (arg == "--trace" && i + 1 < argc) {
+                trace_path = argv[++i];
+                if (!aoc::trace::ENABLED) {
+                    std::cerr << "Tracing is not built in, configure with -DAOC_TRACE=ON\n";
+                    return 1;
+                }
+            } else if (arg == "--reps" && i + 1 < argc) {
+                reps = std::max(1, aoc::to_number<int>(argv[++i]));
+            } else if (arg == "--save-baseline" && i + 1 < argc) {
+                save_baseline_path = argv[++i];
+            } else if (arg == "--baseline" && i + 1 < argc) {
+                baseline_path = argv[++i];
+            } else if (arg == "--threshold" && i + 1 < argc) {
+                threshold_percent = aoc::to_number<double>(argv[++i]);
+            } else if (arg == "--min-ms" && i + 1 < argc) {
+                min_ms = aoc::to_number<double>(argv[++i]);
+            } else {
+                usage(argv[0]);
+                return 1;
+            }
+        }
+    } catch (const std::invalid_argument& e) {
+        std::cerr << e.what() << "\n";
+        usage(argv[0]);
+        return 1;
+    }
+
+    // read the baseline first, so a missing file doesn't waste a run
+    Baseline baseline;
+    if (baseline_path) {
+        try {
+            baseline = loadBaseline(*baseline_path);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << "\n";
+            return 1;
+        }
+    }
+
+    // the main thread runs tasks while waiting, so it counts as one of the threads
+    aoc::ThreadPool pool(num_threads - 1);
+    aoc::ThreadPool part_pool(num_threads - 1);
+    std::vector<std::vector<DayRun>> batches(reps);
+    std::vector<aoc::Clock::duration> batch_walls;
+    for (auto& runs : batches) batch_walls.push_back(runBatch(pool, part_pool, runs));
+
+    // outputs, allocations and the schedule are shown for the first batch
+    const std::vector<DayRun>& runs = batches.front();
+    for (const DayRun& run : runs) {
+        std::cout << "===== " << run.solution->name() << " =====\n";
+        std::cout << run.part1_out.str() << run.part2_out.str();
+    }
+
+    const std::vector<DayTimes> times = medianTimes(batches);
+    std::cout << "\n";
+    if (reps > 1) std::cout << "Median of " << reps << " runs:\n";
+    std::vector<double> batch_wall_ms;
+    for (const aoc::Clock::duration wall : batch_walls) batch_wall_ms.push_back(toMs(wall));
+    printTable(times, median(std::move(batch_wall_ms)));
+    if (aoc::ALLOC_STATS_ENABLED) printAllocTable(runs);
+    printSchedule(runs, num_threads, batch_walls.front());
+    aoc::writeTrace(trace_path);
+
+    if (save_baseline_path) {
+        saveBaseline(*save_baseline_path, times);
+        std::cout << "\nSaved baseline to " << *save_baseline_path << "\n";
+    }
+    if (baseline_path && !compareBaseline(baseline, times, threshold_percent, min_ms)) return 2;
+}